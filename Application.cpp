@@ -2,61 +2,334 @@
 #include "Application.h"
 
 //C system headers
+#ifdef __linux__
+#include <sys/resource.h>
+#endif /* __linux__ */
 
 //C++ system headers
 #include <cstdlib>
 #include <cstdio>
-#include <sstream>
-#include <iomanip>
+#include <cstring>
+#include <charconv>
 #include <random>
 #include <thread>
+#include <algorithm>
+#include <system_error>
 
 //Other libraries headers
 
 //Own components headers
+#include "montecarlo/BatchClassifier.h"
+#include "common/AllocationCounter.h"
 
 namespace {
 constexpr int32_t MONITOR_WIDTH = 1920;
 constexpr int32_t MONITOR_HEIGHT = 1080;
 
-constexpr int32_t DRAW_STEP = 100;
+//used when the refresh rate of the display can not be queried
+constexpr int32_t DEFAULT_REFRESH_RATE = 60;
 
-const double HASH_1 = (6 * sqrt(10)) / 7;
-const double HASH_2 = HASH_1 / 2;
-const double HASH_3 = ( (3 * sqrt(33)) - 7) / 112;
+//outside points which the evaluation thread may run ahead of the renderer.
+//Further points are still counted, but not drawn
+constexpr size_t PIPELINE_QUEUE_CAPACITY = 1 << 20;
+
+//points classified by the evaluation thread between two publications of
+//the counters and two convergence checks
+constexpr size_t PIPELINE_BLOCK_SIZE = 4096;
+
+//samples evaluated between two convergence checks. Does not depend on
+//the threads count, so the stopping point is reproducible
+constexpr uint64_t CONVERGENCE_ROUND_SIZE = 1 << 21;
+
+//minimum in-oval samples before the confidence interval is trusted
+constexpr uint64_t CONVERGENCE_MIN_SAMPLES = 10000;
+
+//cells of the StratifiedEstimator grid over the bounding box of the oval
+constexpr uint32_t STRATIFIED_GRID_WIDTH = 128;
+constexpr uint32_t STRATIFIED_GRID_HEIGHT = 64;
+
+//longest line read in merge mode. The records are about 200 characters
+constexpr size_t PARTIAL_RECORD_MAX_LENGTH = 512;
+
+//two-sided 95% quantile of the standard normal distribution
+constexpr double Z_95 = 1.959963984540054;
+
+const char* getPrecisionName(const uint8_t precision) {
+  return (Precision::FLOAT == precision) ? "float" : "double";
+}
+
+//the OccupancyGrid is built for double precision points only
+void evaluateBlock(const ShapeKernels &shape, const OccupancyGrid *grid,
+                   const double *xs, const double *ys, const size_t count,
+                   const MonteCarloArgs &args, const uint8_t kernel,
+                   EvaluationCounters &outCounters) {
+  if (nullptr != grid) {
+    grid->evaluate(xs, ys, count, args, kernel, outCounters);
+  } else {
+    shape.evaluate(xs, ys, count, args, kernel, outCounters);
+  }
+}
+
+void evaluateBlock(const ShapeKernels &shape, const OccupancyGrid *,
+                   const float *xs, const float *ys, const size_t count,
+                   const MonteCarloArgs &args, const uint8_t kernel,
+                   EvaluationCounters &outCounters) {
+  shape.evaluateFloat(xs, ys, count, args, kernel, outCounters);
+}
+
+//copies the text without the null terminator. Returns the new end
+char* appendText(char *first, char *last, const char *text) {
+  while ((first != last) && ('\0' != *text)) {
+    *first = *text;
+    ++first;
+    ++text;
+  }
+
+  return first;
+}
 }
 
 using Time = std::chrono::high_resolution_clock;
 
 int32_t Application::init(const ApplicationCfg &cfg) {
   _showTexts = cfg.showTexts;
+  _headless = cfg.headless;
+  _showWorkerStats = cfg.showWorkerStats;
+  _pointStorage = (cfg.headless && cfg.streaming) ?
+      static_cast<uint8_t>(PointStorage::REGENERATE) : cfg.pointStorage;
+  _samplesCount = cfg.samplesCount;
+  _showChecksum = cfg.showChecksum;
+  _ciHalfWidth = cfg.ciHalfWidth;
+  _renderPipeline = cfg.renderPipeline;
+  _stratified = cfg.stratified && cfg.headless;
+  if (cfg.stratified && !cfg.headless) {
+    fprintf(stderr, "Warning, --stratified works only in headless mode. "
+        "Ignoring it\n");
+  }
+  const bool isPrecisionSupported = cfg.headless && !_stratified;
+  if (!isPrecisionSupported &&
+      ((Precision::DOUBLE != cfg.precision) || cfg.comparePrecision)) {
+    fprintf(stderr, "Warning, the single precision evaluation works only in "
+        "headless mode without --stratified. Ignoring it\n");
+  }
+  _precision = isPrecisionSupported ?
+      cfg.precision : static_cast<uint8_t>(Precision::DOUBLE);
+  _comparePrecision = cfg.comparePrecision && isPrecisionSupported;
+  //both precisions must see the same samples, which are regenerated
+  //instead of being stored twice
+  if (_comparePrecision) {
+    _pointStorage = PointStorage::REGENERATE;
+  }
+
+  _isRangeWorker = cfg.isRangeWorker && cfg.headless;
+  if (_isRangeWorker) {
+    if (_stratified || _comparePrecision || (0.0 < _ciHalfWidth)) {
+      fprintf(stderr, "Error, --range can not be combined with "
+          "--stratified, --compare-precision or --ci-halfwidth\n");
+
+      return EXIT_FAILURE;
+    }
+
+    //the samples of the range are generated from their global indices
+    _pointStorage = PointStorage::REGENERATE;
+    _rangeFirstIdx = cfg.rangeFirstIdx;
+    _samplesCount = cfg.rangeCount;
+  }
+  //the heatmap is interactive only and always runs on the pixel buffer
+  _heatmap = cfg.heatmap && !cfg.headless;
+  _pointsLayer = _heatmap ?
+      static_cast<uint8_t>(PointsLayer::STREAMING) : cfg.pointsLayer;
   memset(&_inputEvent, 0, sizeof (_inputEvent));
 
-  if ( EXIT_SUCCESS != initGraphics()) {
+  _shape = ShapeFactory::getShapeKernels(cfg.shapeType);
+  if (nullptr == _shape) {
+    fprintf( stderr, "Error, unknown shape type: %hhu\n", cfg.shapeType);
+
+    return EXIT_FAILURE;
+  }
+
+  //only some shapes have SIMD and segment table kernels. The others
+  //always run the scalar one
+  _classifierKernel = _shape->honorsClassifierKernel ?
+      BatchClassifier::resolveKernel(cfg.classifierKernel) :
+      static_cast<uint8_t>(ClassifierKernel::SCALAR);
+
+  //the merge only combines the counters of the workers
+  _mergePartials = cfg.mergePartials && cfg.headless;
+  if (_mergePartials) {
+    _partialRecords = cfg.partialRecords;
+    return EXIT_SUCCESS;
+  }
+
+  if (!_headless && (EXIT_SUCCESS != initGraphics())) {
     fprintf( stderr, "Error, initGraphics() failed\n");
 
     return EXIT_FAILURE;
   }
 
-  generatePoints(MONITOR_WIDTH, MONITOR_HEIGHT, cfg.samplesCount);
+  if (!_headless) {
+    initFrameBudget(cfg.frameBudgetMs);
+  }
+
+  if (_heatmap && (EXIT_SUCCESS != _densityGrid.init(MONITOR_WIDTH,
+      MONITOR_HEIGHT))) {
+    fprintf( stderr, "Error, _densityGrid.init() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  if (isParallel() && (EXIT_SUCCESS != _evaluator.init(cfg.threadsCount,
+      cfg.schedulingPolicy))) {
+    fprintf( stderr, "Error, _evaluator.init() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  if (cfg.useFixedSeed) {
+    _seed = cfg.seed;
+  } else {
+    std::random_device rd; /* seed for the pseudo random engines */
+    _seed = (static_cast<uint64_t>(rd()) << 32) | rd();
+  }
+
+  const uint32_t workersCount =
+      isParallel() ? _evaluator.getThreadsCount() : 1;
+  if (EXIT_SUCCESS != _pointGenerator.init(cfg.samplerType, workersCount,
+          MONITOR_WIDTH, MONITOR_HEIGHT, _seed)) {
+    fprintf( stderr, "Error, _pointGenerator.init() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  if (_isRangeWorker && !_pointGenerator.isIndexAddressable()) {
+    fprintf( stderr, "Error, --range needs a sampler which can generate "
+        "any range of samples, %s can not\n",
+        _pointGenerator.getSamplerName());
+
+    return EXIT_FAILURE;
+  }
+
+  //the estimator uses only the samples inside the bounding ellipse, so
+  //it stays unbiased when all of them are generated there
+  if (SamplingDomain::ELLIPSE == cfg.samplingDomain) {
+    const MonteCarloArgs args = createArgs();
+    _pointGenerator.setEllipseDomain(args.animationCenter, args.ovalRadius);
+  }
+
+  if (_stratified && (EXIT_SUCCESS != _stratifiedEstimator.init(
+      STRATIFIED_GRID_WIDTH, STRATIFIED_GRID_HEIGHT))) {
+    fprintf( stderr, "Error, _stratifiedEstimator.init() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  _useOccupancyGrid = cfg.occupancyGrid && _headless && !_stratified;
+  if (_useOccupancyGrid &&
+      (_comparePrecision || (Precision::FLOAT == _precision))) {
+    fprintf(stderr, "Warning, the occupancy grid works only in double "
+        "precision. Ignoring it\n");
+    _useOccupancyGrid = false;
+  }
+  if (_useOccupancyGrid) {
+    const auto buildStart = Time::now();
+    const char *cachePath = cfg.occupancyCachePath.empty() ?
+        nullptr : cfg.occupancyCachePath.c_str();
+    if (EXIT_SUCCESS != _occupancyGrid.init(*_shape, createArgs(),
+            cachePath)) {
+      fprintf( stderr, "Error, _occupancyGrid.init() failed\n");
+
+      return EXIT_FAILURE;
+    }
+
+    printf("Occupancy grid %s in %lld ms, mixed cells: %.2f%%\n",
+        _occupancyGrid.isLoadedFromCache() ? "loaded" : "built",
+        static_cast<long long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                Time::now() - buildStart).count()),
+        _occupancyGrid.getMixedCellsRatio() * 100.0);
+  }
+
+  if (!_headless && !_heatmap && _renderPipeline &&
+      (EXIT_SUCCESS != _outSamplesQueue.init(PIPELINE_QUEUE_CAPACITY))) {
+    fprintf( stderr, "Error, _outSamplesQueue.init() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  if ((_headless && _stratified) || _heatmap ||
+      (PointStorage::REGENERATE == _pointStorage)) {
+    //the samples are generated on the fly during the evaluation
+    return EXIT_SUCCESS;
+  }
+
+  _pointsToEvaluate.setPlacement(cfg.memoryPlacement);
+  _pointsToEvaluateFloat.setPlacement(cfg.memoryPlacement);
+  if ((PointStorage::PACKED == _pointStorage) && (EXIT_SUCCESS !=
+      _packedPoints.init(MONITOR_WIDTH, MONITOR_HEIGHT,
+          cfg.memoryPlacement))) {
+    fprintf( stderr, "Error, _packedPoints.init() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  const auto generationStart = Time::now();
+  generatePoints(_samplesCount);
+
+  if (_headless) {
+    printf("Generated %llu points in %lld ms\n",
+        static_cast<unsigned long long>(_samplesCount),
+        static_cast<long long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                Time::now() - generationStart).count()));
+  }
 
   return EXIT_SUCCESS;
 }
 
 void Application::deinit() {
-  _renderer.deinit();
-}
+  if (isParallel()) {
+    _evaluator.deinit();
+  }
 
-void Application::start() {
-  const double X_RADIUS = MONITOR_WIDTH / 2;
-  const double Y_RADIUS = X_RADIUS / 2;
+  if (!_headless) {
+    _renderer.deinit();
+  }
+}
 
+MonteCarloArgs Application::createArgs() const {
   MonteCarloArgs args;
   args.animationCenter = Point(MONITOR_WIDTH / 2, MONITOR_HEIGHT / 2);
   args.animationScale = 120.0;
-  args.ovalRadius = Point(X_RADIUS, Y_RADIUS);
+  args.ovalRadius = Point(_shape->boundingRadiusX * args.animationScale,
+      _shape->boundingRadiusY * args.animationScale);
+
+  return args;
+}
+
+int32_t Application::start() {
+  const MonteCarloArgs args = createArgs();
 
-  monteCarlo(args);
+  if (_mergePartials) {
+    return monteCarloMerge(args);
+  }
+
+  if (_stratified) {
+    monteCarloStratified(args);
+  } else if (_isRangeWorker) {
+    monteCarloRange(args);
+  } else if (_comparePrecision) {
+    monteCarloComparePrecision(args);
+  } else if (_headless) {
+    monteCarloHeadless(args);
+  } else if (_renderPipeline || _heatmap) {
+    monteCarloPipelined(args);
+    printFrameAllocations();
+  } else {
+    monteCarlo(args);
+    printFrameAllocations();
+  }
+
+  return EXIT_SUCCESS;
 }
 
 int32_t Application::initGraphics() {
@@ -66,8 +339,15 @@ int32_t Application::initGraphics() {
     return EXIT_FAILURE;
   }
 
-  if ( EXIT_SUCCESS != _pointsFBO.init(&_renderer, Textures::VBO, SDL_Point { 0,
-      0 }, MONITOR_WIDTH, MONITOR_HEIGHT)) {
+  if (PointsLayer::STREAMING == _pointsLayer) {
+    if ( EXIT_SUCCESS != _pointsPixelBuffer.init(&_renderer, Textures::VBO,
+        SDL_Point { 0, 0 }, MONITOR_WIDTH, MONITOR_HEIGHT)) {
+      fprintf( stderr, "Error in _pointsPixelBuffer.init()\n");
+
+      return EXIT_FAILURE;
+    }
+  } else if ( EXIT_SUCCESS != _pointsFBO.init(&_renderer, Textures::VBO,
+      SDL_Point { 0, 0 }, MONITOR_WIDTH, MONITOR_HEIGHT)) {
     fprintf( stderr, "Error in _pointsVBO.init()\n");
 
     return EXIT_FAILURE;
@@ -75,7 +355,7 @@ int32_t Application::initGraphics() {
 
   if ( EXIT_SUCCESS
       != _texts[Textures::TIME].init(_renderer.getTextureContainer(),
-          Textures::TIME, SDL_Point { 20, 20 }, "Time spent: 0 ms",
+          SDL_Point { 20, 20 }, "Time spent: 0 ms",
           FontSize::SMALL)) {
     fprintf( stderr, "Error in _texts[Textures::TIME].init()\n");
 
@@ -84,7 +364,7 @@ int32_t Application::initGraphics() {
 
   if ( EXIT_SUCCESS
       != _texts[Textures::ALL_POINTS].init(_renderer.getTextureContainer(),
-          Textures::ALL_POINTS, SDL_Point { 1500, 20 }, "Points: ",
+          SDL_Point { 1500, 20 }, "Points: ",
           FontSize::SMALL)) {
     fprintf( stderr, "Error in _texts[Textures::TIME].init()\n");
 
@@ -93,7 +373,7 @@ int32_t Application::initGraphics() {
 
   if ( EXIT_SUCCESS
       != _texts[Textures::ERROR].init(_renderer.getTextureContainer(),
-          Textures::ERROR, SDL_Point { 20, 1020 }, "Error: 0.0%",
+          SDL_Point { 20, 1020 }, "Error: 0.0%",
           FontSize::SMALL)) {
     fprintf( stderr, "Error in _texts[Textures::TIME].init()\n");
 
@@ -103,200 +383,742 @@ int32_t Application::initGraphics() {
   return EXIT_SUCCESS;
 }
 
-void Application::drawWorld(const std::vector<Point> &outSamples) {
-  _renderer.clearScreen();
-
-  _pointsFBO.unlockFBO();
+void Application::initFrameBudget(const double frameBudgetMs) {
+  if (0.0 < frameBudgetMs) {
+    _frameBudget = std::chrono::nanoseconds(
+        static_cast<int64_t>(frameBudgetMs * 1000000.0));
+    return;
+  }
 
-  SDL_Point arr[DRAW_STEP];
-  for (int32_t i = 0; i < DRAW_STEP; ++i) {
-    arr[i].x = static_cast<int32_t>(outSamples[i].x);
-    arr[i].y = static_cast<int32_t>(outSamples[i].y);
+  int32_t refreshRate = _renderer.getRefreshRate();
+  if (0 >= refreshRate) {
+    refreshRate = DEFAULT_REFRESH_RATE;
   }
+  _frameBudget = std::chrono::nanoseconds(1000000000 / refreshRate);
+}
 
-  _renderer.drawPoints(arr, DRAW_STEP);
+void Application::drawWorld(const SDL_Point *outSamples,
+                            const int32_t count) {
+  _renderer.clearScreen();
 
-  _pointsFBO.lockFBO();
+  if (_heatmap) {
+    _densityGrid.toRGBA(_pointsPixelBuffer.getPixels());
+    _pointsPixelBuffer.invalidate();
+    _pointsPixelBuffer.uploadChanges();
+    _renderer.drawTexture(&_pointsPixelBuffer.drawParams);
+  } else if (PointsLayer::STREAMING == _pointsLayer) {
+    _pointsPixelBuffer.drawPoints(outSamples, count);
+    _pointsPixelBuffer.uploadChanges();
+    _renderer.drawTexture(&_pointsPixelBuffer.drawParams);
+  } else {
+    //the render target switch is needed only if there is something to add
+    if (0 < count) {
+      _pointsFBO.unlockFBO();
+      _renderer.drawPoints(outSamples, count);
+      _pointsFBO.lockFBO();
+    }
 
-  _renderer.drawTexture(&_pointsFBO.drawParams);
+    _renderer.drawTexture(&_pointsFBO.drawParams);
+  }
 
   if (_showTexts) {
     for (uint8_t i = 0; i < Textures::TEXTS_COUNT; ++i) {
-      _renderer.drawTexture(&_texts[i].drawParams);
+      _renderer.drawTextureArr(_texts[i].glyphs, _texts[i].glyphsCount);
     }
   }
 
   _renderer.finishFrame();
+
+  //the first frame warms up all buffers
+  ++_framesCount;
+  if (1 == _framesCount) {
+    _firstFrameAllocations = AllocationCounter::getAllocationsCount();
+  }
 }
 
-bool Application::isInBatman(const Point &point, const Point &origin,
-                             const double scale) const {
-  const double POS_X = (point.x - origin.x) / scale;
-  const double POS_Y = (point.y - origin.y) / scale;
-  double tempX = 0.0;
-  double tempY = 0.0;
+void Application::printFrameAllocations() const {
+  if (!AllocationCounter::isEnabled() || (2 > _framesCount)) {
+    return;
+  }
 
-  if (POS_Y < 0.0) {
-    /* left upper wing */
-    if (POS_X <= -3) {
-      tempX = (-7 * sqrt(1 - ( (POS_Y * POS_Y) / 9.0)));
-      return POS_X >= tempX ? true : false;
-    }
+  const uint64_t allocations =
+      AllocationCounter::getAllocationsCount() - _firstFrameAllocations;
+  const uint64_t frames = _framesCount - 1;
+  printf("Heap allocations after the first frame: %llu in %llu frames "
+      "(%.2f per frame)\n", static_cast<unsigned long long>(allocations),
+      static_cast<unsigned long long>(frames),
+      static_cast<double>(allocations) / static_cast<double>(frames));
+}
+
+void Application::generatePoints(const uint64_t maxPoints) {
+  if (PointStorage::PACKED == _pointStorage) {
+    generatePackedPoints(maxPoints);
+  } else if (Precision::FLOAT == _precision) {
+    generatePoints(maxPoints, _pointsToEvaluateFloat);
+  } else {
+    generatePoints(maxPoints, _pointsToEvaluate);
+  }
+}
+
+template <typename Real>
+void Application::generatePoints(const uint64_t maxPoints,
+                                 BasicPointsSoA<Real> &outPoints) {
+  //allocate enough memory for all points so no unneeded reallocation
+  //occur at run-time
+  outPoints.resize(maxPoints);
+
+  Real *xs = outPoints.x.data();
+  Real *ys = outPoints.y.data();
+
+  if (!_headless || !_pointGenerator.isIndexAddressable()) {
+    _pointGenerator.generate(0, 0, maxPoints, xs, ys);
+    return;
+  }
+
+  //every sub-range can be generated independently - use all workers
+  _evaluator.evaluate(maxPoints,
+      [this, xs, ys](const uint32_t workerId, const uint64_t firstIdx,
+                     const uint64_t count, EvaluationCounters &) {
+        _pointGenerator.generate(workerId, firstIdx, count, xs + firstIdx,
+            ys + firstIdx);
+      });
+}
 
-    /* left shoulder */
-    if (POS_X > -3.0 && POS_X <= -1.0) {
-      tempX = -POS_X;
-      const double LOC_HASH = fabs(tempX) - 1;
-      tempY = - (HASH_1 + (1.5 - 0.5 * tempX))
-          + HASH_2 * sqrt(4.0 - (LOC_HASH * LOC_HASH));
-      return POS_Y > tempY ? true : false;
+void Application::generatePackedPoints(const uint64_t maxPoints) {
+  _packedPoints.resize(maxPoints);
+
+  const auto generateRange = [this](const uint32_t workerId,
+      const uint64_t firstIdx, const uint64_t count, EvaluationCounters &) {
+    alignas(32) double xs[STREAM_BLOCK_SIZE];
+    alignas(32) double ys[STREAM_BLOCK_SIZE];
+
+    for (uint64_t offset = 0; offset < count; offset += STREAM_BLOCK_SIZE) {
+      const size_t blockSize = static_cast<size_t>(
+          std::min<uint64_t>(STREAM_BLOCK_SIZE, count - offset));
+      _pointGenerator.generate(workerId, firstIdx + offset, blockSize, xs,
+          ys);
+      _packedPoints.pack(firstIdx + offset, blockSize, xs, ys);
     }
+  };
+
+  if (!_headless || !_pointGenerator.isIndexAddressable()) {
+    EvaluationCounters unused;
+    generateRange(0, 0, maxPoints, unused);
+    return;
+  }
+
+  //every sub-range can be generated independently - use all workers
+  _evaluator.evaluate(maxPoints, generateRange);
+}
+
+void Application::loadPointsBlock(const uint64_t firstIdx,
+                                  const size_t count, double *bufferXs,
+                                  double *bufferYs, const double *&outXs,
+                                  const double *&outYs) {
+  if (PointStorage::FULL == _pointStorage) {
+    outXs = _pointsToEvaluate.x.data() + firstIdx;
+    outYs = _pointsToEvaluate.y.data() + firstIdx;
+    return;
+  }
+
+  //the interactive mode generates on a single worker
+  loadPoints(0, firstIdx, count, bufferXs, bufferYs);
+  outXs = bufferXs;
+  outYs = bufferYs;
+}
+
+template <typename Real>
+void Application::loadPoints(const uint32_t workerId, const uint64_t firstIdx,
+                             const size_t count, Real *outXs, Real *outYs) {
+  if (PointStorage::PACKED == _pointStorage) {
+    _packedPoints.unpack(firstIdx, count, outXs, outYs);
+  } else {
+    _pointGenerator.generate(workerId, firstIdx, count, outXs, outYs);
+  }
+}
+
+void Application::monteCarlo(const MonteCarloArgs args) {
+  std::chrono::high_resolution_clock::time_point start = Time::now();
 
-    /* exterior left ear */
-    if (POS_X > -1.0 && POS_X <= -0.75) {
-      tempY = 9.0 + 8.0 * POS_X;
-      return POS_Y > -tempY ? true : false;
+  //all points outside of the target since the previous frame
+  std::vector<SDL_Point> outSamples;
+  outSamples.reserve(STREAM_BLOCK_SIZE);
+  Time::time_point nextFrameTime = start + _frameBudget;
+
+  uint64_t lastPointsInOval = 0;
+  uint64_t lastPointsInBatman = 0;
+
+  alignas(32) double bufferXs[STREAM_BLOCK_SIZE];
+  alignas(32) double bufferYs[STREAM_BLOCK_SIZE];
+  uint8_t regions[STREAM_BLOCK_SIZE];
+
+  const size_t pointsCount = static_cast<size_t>(_samplesCount);
+  for (size_t blockStart = 0; blockStart < pointsCount;
+      blockStart += STREAM_BLOCK_SIZE) {
+    const size_t blockSize =
+        std::min(STREAM_BLOCK_SIZE, pointsCount - blockStart);
+    const double *xs = nullptr;
+    const double *ys = nullptr;
+    loadPointsBlock(blockStart, blockSize, bufferXs, bufferYs, xs, ys);
+    _shape->classify(xs, ys, blockSize, args, regions);
+
+    for (size_t i = 0; i < blockSize; ++i) {
+      if (PointRegion::OUT_OF_BOUNDS == regions[i]) {
+        continue;
+      }
+
+      ++_pointsInOval;
+
+      if (PointRegion::INSIDE_SHAPE == regions[i]) {
+        ++_pointsInBatman;
+        continue;
+      }
+
+      //remember only points outside of target
+      outSamples.push_back(SDL_Point { static_cast<int32_t>(xs[i]),
+          static_cast<int32_t>(ys[i]) });
     }
+    _totalEvaluatedPoints += blockSize;
 
-    /* interior left ear */
-    if (POS_X > -0.75 && POS_X <= -0.5) {
-      tempY = -3 * POS_X + 0.75;
-      return POS_Y > -tempY ? true : false;
+    //present at most one frame per frame budget
+    if (Time::now() < nextFrameTime) {
+      continue;
     }
 
-    /* top of head */
-    if (POS_X > -0.5 && POS_X <= 0.5) {
-      tempY = 2.25;
-      return POS_Y > -tempY ? true : false;
+    if (checkForExitRequest()) {
+      return;
     }
 
-    /* interior right ear */
-    if (POS_X > 0.5 && POS_X <= 0.75) {
-      tempY = 3 * POS_X + 0.75;
-      return POS_Y > -tempY ? true : false;
+    updateTexts(args, start);
+    drawWorld(outSamples.data(), static_cast<int32_t>(outSamples.size()));
+    outSamples.clear();
+    nextFrameTime = Time::now() + _frameBudget;
+
+    _hitRatioStats.addBernoulliBatch(_pointsInOval - lastPointsInOval,
+        _pointsInBatman - lastPointsInBatman);
+    lastPointsInOval = _pointsInOval;
+    lastPointsInBatman = _pointsInBatman;
+    if (isConverged(args)) {
+      break;
     }
+  }
 
-    /* exterior right ear */
-    if (POS_X > 0.75 && POS_X <= 1.0) {
-      tempY = 9.0 - 8 * POS_X;
-      return POS_Y > -tempY ? true : false;
+  //perform the final draw
+  updateTexts(args, start);
+  drawWorld(outSamples.data(), static_cast<int32_t>(outSamples.size()));
+  waitForExit();
+}
+
+void Application::monteCarloPipelined(const MonteCarloArgs &args) {
+  const std::chrono::high_resolution_clock::time_point start = Time::now();
+
+  try {
+    _evaluationThread = _heatmap ?
+        std::thread(&Application::heatmapEvaluationLoop, this, args) :
+        std::thread(&Application::evaluationLoop, this, args);
+  } catch (const std::system_error &ex) {
+    if (_heatmap) {
+      fprintf(stderr, "Error, could not start the evaluation thread: %s\n",
+          ex.what());
+      return;
     }
 
-    /* right shoulder */
-    if (POS_X <= 3.0 && POS_X > 1.0) {
-      const double LOC_HASH = fabs(POS_X) - 1.0;
-      tempY = - (HASH_1 + (1.5 - 0.5 * POS_X))
-          + HASH_2 * sqrt(4.0 - (LOC_HASH * LOC_HASH));
-      return POS_Y > tempY ? true : false;
+    fprintf(stderr, "Error, could not start the evaluation thread: %s. "
+        "Evaluating on the main thread\n", ex.what());
+    monteCarlo(args);
+    return;
+  }
+
+  //everything produced since the previous frame is drawn at once
+  std::vector<SDL_Point> frameSamples(_outSamplesQueue.capacity());
+
+  while (true) {
+    //must be read before draining the queue - once it is set, the queue
+    //already contains the last points of the evaluation
+    const bool evaluationFinished =
+        _evaluationFinished.load(std::memory_order_acquire);
+
+    if (checkForExitRequest()) {
+      _stopRequested.store(true, std::memory_order_relaxed);
+      _evaluationThread.join();
+      return;
     }
 
-    /* right upper wing */
-    if (POS_X > 3.0) {
-      tempX = (7.0 * sqrt(1 - ( (POS_Y * POS_Y) / 9.0)));
-      return POS_X <= tempX ? true : false;
+    const Time::time_point frameStart = Time::now();
+    //the heatmap does not use the queue - it draws the density grid
+    const size_t samplesCount = _heatmap ? 0 :
+        _outSamplesQueue.popBulk(frameSamples.data(), frameSamples.size());
+
+    syncPublishedCounters();
+    updateTexts(args, start);
+    drawWorld(frameSamples.data(), static_cast<int32_t>(samplesCount));
+
+    if (evaluationFinished
+        && (_heatmap || (samplesCount < frameSamples.size()))) {
+      break;
     }
+
+    //leave the CPU to the evaluation thread until the next frame is due
+    std::this_thread::sleep_until(frameStart + _frameBudget);
+  }
+
+  _evaluationThread.join();
+  syncPublishedCounters();
+
+  const uint64_t droppedSamples = _droppedOutSamples.load();
+  if (0 < droppedSamples) {
+    fprintf(stderr, "Warning, %llu points were evaluated, but not drawn, "
+        "because the renderer could not keep up\n",
+        static_cast<unsigned long long>(droppedSamples));
   }
-  if (POS_Y >= 0) {
-    /* bottom left wing */
-    if (POS_X <= -4.0) {
-      tempX = (-7 * sqrt(1 - ( (POS_Y * POS_Y) / 9.0)));
-      return POS_X >= tempX ? true : false;
+
+  waitForExit();
+}
+
+void Application::evaluationLoop(const MonteCarloArgs args) {
+  EvaluationCounters counters;
+  uint64_t droppedSamples = 0;
+
+  alignas(32) double bufferXs[PIPELINE_BLOCK_SIZE];
+  alignas(32) double bufferYs[PIPELINE_BLOCK_SIZE];
+  uint8_t regions[PIPELINE_BLOCK_SIZE];
+
+  const size_t pointsCount = static_cast<size_t>(_samplesCount);
+  for (size_t blockStart = 0; blockStart < pointsCount;
+      blockStart += PIPELINE_BLOCK_SIZE) {
+    if (_stopRequested.load(std::memory_order_relaxed)) {
+      break;
     }
 
-    /* bottom wing */
-    if (POS_X > -4.0 && POS_X <= 4.0) {
-      const double LOC_HASH = fabs(fabs(POS_X) - 2.0) - 1.0;
-      tempY = (fabs(POS_X / 2) - (HASH_3 * POS_X * POS_X) - 3.0)
-          + sqrt(1 - (LOC_HASH * LOC_HASH));
-      tempY *= -1.0;
-      return POS_Y < tempY ? true : false;
+    const size_t blockEnd =
+        std::min(blockStart + PIPELINE_BLOCK_SIZE, pointsCount);
+    uint64_t blockPointsInOval = 0;
+    uint64_t blockPointsInBatman = 0;
+
+    const double *xs = nullptr;
+    const double *ys = nullptr;
+    loadPointsBlock(blockStart, blockEnd - blockStart, bufferXs, bufferYs,
+        xs, ys);
+    _shape->classify(xs, ys, blockEnd - blockStart, args, regions);
+
+    for (size_t i = 0; i < blockEnd - blockStart; ++i) {
+      const uint8_t region = regions[i];
+      if (PointRegion::OUT_OF_BOUNDS == region) {
+        continue;
+      }
+
+      ++blockPointsInOval;
+
+      if (PointRegion::INSIDE_SHAPE == region) {
+        ++blockPointsInBatman;
+        continue;
+      }
+
+      //never wait for the renderer - the point is already counted
+      const SDL_Point outSample { static_cast<int32_t>(xs[i]),
+          static_cast<int32_t>(ys[i]) };
+      if (!_outSamplesQueue.tryPush(outSample)) {
+        ++droppedSamples;
+      }
     }
 
-    /* bottom right wing */
-    if (POS_X >= 4.0) {
-      tempX = (7.0 * sqrt(1 - ( (POS_Y * POS_Y) / 9.0)));
-      return POS_X <= tempX ? true : false;
+    counters.totalPoints += blockEnd - blockStart;
+    counters.pointsInOval += blockPointsInOval;
+    counters.pointsInBatman += blockPointsInBatman;
+
+    _publishedTotalPoints.store(counters.totalPoints,
+        std::memory_order_relaxed);
+    _publishedPointsInOval.store(counters.pointsInOval,
+        std::memory_order_relaxed);
+    _publishedPointsInBatman.store(counters.pointsInBatman,
+        std::memory_order_relaxed);
+
+    //owned by this thread until it is joined
+    _hitRatioStats.addBernoulliBatch(blockPointsInOval, blockPointsInBatman);
+    if (isConverged(args)) {
+      break;
     }
   }
 
-  return false;
+  _droppedOutSamples.store(droppedSamples, std::memory_order_relaxed);
+  _evaluationFinished.store(true, std::memory_order_release);
 }
 
-void Application::generatePoints(const uint32_t windowWidth,
-                                 const uint32_t windowHeight,
-                                 const uint32_t maxPoints) {
-  //reserve enough memory for all points so no unneeded reallocation
-  //occur at run-time
-  _pointsToEvaluate.reserve(maxPoints);
+void Application::heatmapEvaluationLoop(const MonteCarloArgs args) {
+  EvaluationCounters counters;
 
-  Point currPoint;
-  uint32_t totalPointsGenerated = 0;
+  for (uint64_t firstIdx = 0; firstIdx < _samplesCount;
+      firstIdx += CONVERGENCE_ROUND_SIZE) {
+    if (_stopRequested.load(std::memory_order_relaxed)) {
+      break;
+    }
 
-  std::random_device rd; /* seed for the pseudo random engine */
-  std::mt19937 range(rd()); /* mersenne_twister engine */
-  /* we NEED uniform distribution for Monte Carlo */
-  std::uniform_real_distribution<> distr(0, 1.0);
+    const uint64_t roundSize =
+        std::min(CONVERGENCE_ROUND_SIZE, _samplesCount - firstIdx);
+    const EvaluationCounters roundCounters = _evaluator.evaluate(roundSize,
+        [this, firstIdx, &args](const uint32_t workerId,
+                                const uint64_t rangeIdx,
+                                const uint64_t rangeCount,
+                                EvaluationCounters &outCounters) {
+          alignas(32) double xs[STREAM_BLOCK_SIZE];
+          alignas(32) double ys[STREAM_BLOCK_SIZE];
+          uint8_t regions[STREAM_BLOCK_SIZE];
+
+          for (uint64_t offset = 0; offset < rangeCount;
+              offset += STREAM_BLOCK_SIZE) {
+            const size_t blockSize = static_cast<size_t>(
+                std::min<uint64_t>(STREAM_BLOCK_SIZE, rangeCount - offset));
+
+            _pointGenerator.generate(workerId, firstIdx + rangeIdx + offset,
+                blockSize, xs, ys);
+            _shape->classify(xs, ys, blockSize, args, regions);
+
+            for (size_t i = 0; i < blockSize; ++i) {
+              const bool inShape = (PointRegion::INSIDE_SHAPE == regions[i]);
+              outCounters.pointsInOval +=
+                  (PointRegion::OUT_OF_BOUNDS != regions[i]);
+              outCounters.pointsInBatman += inShape;
+
+              _densityGrid.addSample(xs[i], ys[i], inShape);
+            }
+            outCounters.totalPoints += blockSize;
+          }
+        });
+
+    counters.merge(roundCounters);
+    _publishedTotalPoints.store(counters.totalPoints,
+        std::memory_order_relaxed);
+    _publishedPointsInOval.store(counters.pointsInOval,
+        std::memory_order_relaxed);
+    _publishedPointsInBatman.store(counters.pointsInBatman,
+        std::memory_order_relaxed);
+
+    //owned by this thread until it is joined
+    _hitRatioStats.addBernoulliBatch(roundCounters.pointsInOval,
+        roundCounters.pointsInBatman);
+    if (isConverged(args)) {
+      break;
+    }
+  }
 
-  while (totalPointsGenerated < maxPoints) {
-    ++totalPointsGenerated;
-    currPoint.x = distr(range) * windowWidth;
-    currPoint.y = distr(range) * windowHeight;
+  _evaluationFinished.store(true, std::memory_order_release);
+}
 
-    _pointsToEvaluate.emplace_back(currPoint);
-  }
+void Application::syncPublishedCounters() {
+  _totalEvaluatedPoints =
+      _publishedTotalPoints.load(std::memory_order_relaxed);
+  _pointsInOval = _publishedPointsInOval.load(std::memory_order_relaxed);
+  _pointsInBatman = _publishedPointsInBatman.load(std::memory_order_relaxed);
 }
 
-void Application::monteCarlo(const MonteCarloArgs args) {
-  std::chrono::high_resolution_clock::time_point start = Time::now();
+void Application::monteCarloHeadless(const MonteCarloArgs &args) {
+  const std::chrono::high_resolution_clock::time_point start = Time::now();
 
-  std::vector<Point> outSamples(DRAW_STEP);
-  int32_t currOutSampleIdx = 0;
+  //without a confidence target everything is evaluated in a single round
+  const uint64_t roundSize =
+      (0.0 < _ciHalfWidth) ? CONVERGENCE_ROUND_SIZE : _samplesCount;
 
-  for (const auto &point : _pointsToEvaluate) {
-    ++_totalEvaluatedPoints;
-    if (!inOval(point, args.animationCenter, args.ovalRadius)) {
-      continue;
+  EvaluationCounters counters;
+  for (uint64_t firstIdx = 0; firstIdx < _samplesCount;
+      firstIdx += roundSize) {
+    const EvaluationCounters roundCounters = evaluateRange(args, firstIdx,
+        std::min(roundSize, _samplesCount - firstIdx));
+
+    counters.merge(roundCounters);
+    _hitRatioStats.addBernoulliBatch(roundCounters.pointsInOval,
+        roundCounters.pointsInBatman);
+
+    if (isConverged(args)) {
+      break;
     }
+  }
 
-    ++_pointsInOval;
+  _totalEvaluatedPoints = counters.totalPoints;
+  _pointsInOval = counters.pointsInOval;
+  _pointsInBatman = counters.pointsInBatman;
 
-    if (isInBatman(point, args.animationCenter, args.animationScale)) {
-      ++_pointsInBatman;
-      continue;
+  const std::chrono::duration<double> elapsed = Time::now() - start;
+  printResults(args, elapsed.count());
+}
+
+void Application::monteCarloStratified(const MonteCarloArgs &args) {
+  const std::chrono::high_resolution_clock::time_point start = Time::now();
+
+  const StratifiedResult result = _stratifiedEstimator.estimate(*_shape,
+      args, _pointGenerator, _evaluator, _samplesCount);
+
+  const std::chrono::duration<double> elapsed = Time::now() - start;
+  const uint64_t evaluations =
+      result.probeEvaluations + result.sampleEvaluations;
+
+  printf("Shape: %s, sampler: %s, estimator: stratified %ux%u cells, "
+      "seed: %llu\n", _shape->name, _pointGenerator.getSamplerName(),
+      _stratifiedEstimator.getGridWidth(),
+      _stratifiedEstimator.getGridHeight(),
+      static_cast<unsigned long long>(_seed));
+  printf("Cells inside: %u, outside: %u, boundary: %u\n",
+      result.insideCells, result.outsideCells, result.boundaryCells);
+  printf("Shape evaluations: %llu (probes: %llu, samples: %llu)\n",
+      static_cast<unsigned long long>(evaluations),
+      static_cast<unsigned long long>(result.probeEvaluations),
+      static_cast<unsigned long long>(result.sampleEvaluations));
+  printEstimate(result.area, result.standardError, evaluations,
+      elapsed.count());
+
+  if (_showWorkerStats) {
+    _evaluator.printWorkerStats();
+  }
+}
+
+void Application::monteCarloComparePrecision(const MonteCarloArgs &args) {
+  const uint8_t PRECISIONS[] = { Precision::DOUBLE, Precision::FLOAT };
+  double areas[2] = { 0.0, 0.0 };
+  double standardErrors[2] = { 0.0, 0.0 };
+
+  for (size_t i = 0; i < 2; ++i) {
+    _precision = PRECISIONS[i];
+    _hitRatioStats = RunningStats();
+
+    const std::chrono::high_resolution_clock::time_point start = Time::now();
+    const EvaluationCounters counters = evaluateRange(args, 0, _samplesCount);
+    const std::chrono::duration<double> elapsed = Time::now() - start;
+
+    _totalEvaluatedPoints = counters.totalPoints;
+    _pointsInOval = counters.pointsInOval;
+    _pointsInBatman = counters.pointsInBatman;
+    _hitRatioStats.addBernoulliBatch(counters.pointsInOval,
+        counters.pointsInBatman);
+
+    printResults(args, elapsed.count());
+    printf("\n");
+
+    areas[i] = estimateArea(args);
+    standardErrors[i] = calculateStandardError(args);
+  }
+
+  //the samples are shared, so only the points within a rounding error of
+  //the outline may be classified differently
+  const double difference = areas[1] - areas[0];
+  printf("Precision difference: %.7f (%.3f standard errors)\n", difference,
+      (0.0 < standardErrors[0]) ?
+          fabs(difference) / standardErrors[0] : 0.0);
+}
+
+void Application::monteCarloRange(const MonteCarloArgs &args) {
+  const std::chrono::high_resolution_clock::time_point start = Time::now();
+
+  PartialCounts partial;
+  partial.counters = evaluateRange(args, _rangeFirstIdx, _samplesCount);
+  partial.firstIdx = _rangeFirstIdx;
+  partial.count = _samplesCount;
+  partial.seed = _seed;
+  strncpy(partial.shapeName, _shape->name, sizeof (partial.shapeName) - 1);
+  strncpy(partial.samplerName, _pointGenerator.getSamplerName(),
+      sizeof (partial.samplerName) - 1);
+  strncpy(partial.domainName, _pointGenerator.getDomainName(),
+      sizeof (partial.domainName) - 1);
+  strncpy(partial.precisionName, getPrecisionName(_precision),
+      sizeof (partial.precisionName) - 1);
+
+  //the standard output carries only the record, so it can be piped
+  //directly into a merging process
+  PartialCountsRecord::write(partial, stdout);
+  fflush(stdout);
+
+  const std::chrono::duration<double> elapsed = Time::now() - start;
+  fprintf(stderr, "Evaluated samples [%llu, %llu) in %.3f ms\n",
+      static_cast<unsigned long long>(_rangeFirstIdx),
+      static_cast<unsigned long long>(_rangeFirstIdx + _samplesCount),
+      elapsed.count() * 1000.0);
+}
+
+int32_t Application::monteCarloMerge(const MonteCarloArgs &args) {
+  PartialCountsMerger merger;
+  const auto addRecord = [&merger](const char *line) {
+    //anything else the workers printed is skipped
+    if ('{' != line[0]) {
+      return EXIT_SUCCESS;
     }
 
-    //remember only points outside of target
-    outSamples[currOutSampleIdx] = point;
-    ++currOutSampleIdx;
+    PartialCounts partial;
+    if (EXIT_SUCCESS != PartialCountsRecord::parse(line, partial)) {
+      fprintf(stderr, "Error, malformed partial counts record: %s\n",
+          line);
 
-    //update the draw target only once every DRAW_STEP
-    if (currOutSampleIdx < DRAW_STEP) {
-      continue;
+      return EXIT_FAILURE;
     }
 
-    if (checkForExitRequest()) {
-      return;
+    return merger.add(partial);
+  };
+
+  if (_partialRecords.empty()) {
+    char line[PARTIAL_RECORD_MAX_LENGTH];
+    while (nullptr != fgets(line, sizeof (line), stdin)) {
+      if (EXIT_SUCCESS != addRecord(line)) {
+        return EXIT_FAILURE;
+      }
     }
+  } else {
+    for (const std::string &record : _partialRecords) {
+      if (EXIT_SUCCESS != addRecord(record.c_str())) {
+        return EXIT_FAILURE;
+      }
+    }
+  }
 
-    updateTexts(args, start);
-    drawWorld(outSamples);
-    currOutSampleIdx = 0;
+  PartialCounts total;
+  if (EXIT_SUCCESS != merger.merge(total)) {
+    return EXIT_FAILURE;
   }
 
-  //perform the final draw
-  updateTexts(args, start);
-  drawWorld(outSamples);
-  waitForExit();
+  if (0 != strcmp(total.shapeName, _shape->name)) {
+    fprintf(stderr, "Error, the partial counts are for shape %s. Merge "
+        "them with --shape=%s\n", total.shapeName, total.shapeName);
+
+    return EXIT_FAILURE;
+  }
+
+  _totalEvaluatedPoints = total.counters.totalPoints;
+  _pointsInOval = total.counters.pointsInOval;
+  _pointsInBatman = total.counters.pointsInBatman;
+  _hitRatioStats.addBernoulliBatch(_pointsInOval, _pointsInBatman);
+
+  printf("Shape: %s, sampler: %s, domain: %s, precision: %s, seed: %llu\n",
+      total.shapeName, total.samplerName, total.domainName,
+      total.precisionName, static_cast<unsigned long long>(total.seed));
+  printf("Merged %zu partial counts starting at sample %llu\n",
+      merger.getPartialsCount(),
+      static_cast<unsigned long long>(total.firstIdx));
+  printCounters();
+  printArea(estimateArea(args), calculateStandardError(args));
+
+  if (_showChecksum) {
+    printf("Checksum: %016llx\n",
+        static_cast<unsigned long long>(calculateChecksum()));
+  }
+
+  return EXIT_SUCCESS;
+}
+
+EvaluationCounters Application::evaluateRange(const MonteCarloArgs &args,
+                                              const uint64_t firstIdx,
+                                              const uint64_t count) {
+  if (Precision::FLOAT == _precision) {
+    return evaluateRange(args, _pointsToEvaluateFloat, firstIdx, count);
+  }
+
+  return evaluateRange(args, _pointsToEvaluate, firstIdx, count);
+}
+
+template <typename Real>
+EvaluationCounters Application::evaluateRange(
+    const MonteCarloArgs &args, const BasicPointsSoA<Real> &points,
+    const uint64_t firstIdx, const uint64_t count) {
+  const uint8_t kernel = _classifierKernel;
+  const ShapeKernels *shape = _shape;
+  const OccupancyGrid *grid = _useOccupancyGrid ? &_occupancyGrid : nullptr;
+
+  if (PointStorage::FULL == _pointStorage) {
+    const Real *xs = points.x.data() + firstIdx;
+    const Real *ys = points.y.data() + firstIdx;
+
+    return _evaluator.evaluate(count,
+        [xs, ys, kernel, shape, grid, &args](const uint32_t,
+            const uint64_t rangeIdx, const uint64_t rangeCount,
+            EvaluationCounters &outCounters) {
+          evaluateBlock(*shape, grid, xs + rangeIdx, ys + rangeIdx,
+              rangeCount, args, kernel, outCounters);
+        });
+  }
+
+  return _evaluator.evaluate(count,
+      [this, kernel, shape, grid, firstIdx, &args](const uint32_t workerId,
+          const uint64_t rangeIdx, const uint64_t rangeCount,
+          EvaluationCounters &outCounters) {
+        alignas(32) Real xs[STREAM_BLOCK_SIZE];
+        alignas(32) Real ys[STREAM_BLOCK_SIZE];
+
+        for (uint64_t offset = 0; offset < rangeCount;
+            offset += STREAM_BLOCK_SIZE) {
+          const size_t blockSize = static_cast<size_t>(
+              std::min<uint64_t>(STREAM_BLOCK_SIZE, rangeCount - offset));
+
+          loadPoints(workerId, firstIdx + rangeIdx + offset, blockSize, xs,
+              ys);
+          evaluateBlock(*shape, grid, xs, ys, blockSize, args, kernel,
+              outCounters);
+        }
+      });
+}
+
+void Application::printResults(const MonteCarloArgs &args,
+                               const double evaluationSeconds) const {
+  printf("Shape: %s, sampler: %s, domain: %s, precision: %s, kernel: %s, "
+      "seed: %llu\n", _shape->name, _pointGenerator.getSamplerName(),
+      _pointGenerator.getDomainName(), getPrecisionName(_precision),
+      BatchClassifier::getKernelName(_classifierKernel),
+      static_cast<unsigned long long>(_seed));
+  printCounters();
+  printEstimate(estimateArea(args), calculateStandardError(args),
+      _totalEvaluatedPoints, evaluationSeconds);
+
+  if (0.0 < _ciHalfWidth) {
+    printf("Confidence target +/- %.7f %s after %llu of %llu samples\n",
+        _ciHalfWidth, isConverged(args) ? "reached" : "not reached",
+        static_cast<unsigned long long>(_totalEvaluatedPoints),
+        static_cast<unsigned long long>(_samplesCount));
+  }
+
+  if (_showChecksum) {
+    printf("Checksum: %016llx\n",
+        static_cast<unsigned long long>(calculateChecksum()));
+  }
+
+#ifdef __linux__
+  rusage usage;
+  if (0 == getrusage(RUSAGE_SELF, &usage)) {
+    printf("Peak memory usage: %ld KB\n", usage.ru_maxrss);
+  }
+#endif /* __linux__ */
+
+  if (_showWorkerStats) {
+    _evaluator.printWorkerStats();
+  }
+}
+
+void Application::printCounters() const {
+  printf("Points evaluated: %llu, in oval: %llu, in shape: %llu\n",
+      static_cast<unsigned long long>(_totalEvaluatedPoints),
+      static_cast<unsigned long long>(_pointsInOval),
+      static_cast<unsigned long long>(_pointsInBatman));
 }
 
-bool Application::inOval(const Point &point, const Point &origin,
-                         const Point &ovalRadius) const {
-  const double posX = point.x - origin.x;
-  const double posY = point.y - origin.y;
-  const double deltaX = posX / ovalRadius.x;
-  const double deltaY = posY / ovalRadius.y;
+void Application::printArea(const double area,
+                            const double standardError) const {
+  if (_shape->hasAnalyticArea) {
+    printf("Estimated area: %.7f (analytic: %.7f)\n", area,
+        _shape->analyticArea);
+  } else {
+    printf("Estimated area: %.7f (no analytic area)\n", area);
+  }
+  printf("95%% confidence interval: +/- %.7f\n", Z_95 * standardError);
+  if (_shape->hasAnalyticArea) {
+    printf("Error: %.3f%%\n", (fabs(area - _shape->analyticArea)
+        / _shape->analyticArea) * 100.0);
+  }
+}
 
-  return ( (deltaX * deltaX) + (deltaY * deltaY) <= 1.0) ? true : false;
+void Application::printEstimate(const double area,
+                                const double standardError,
+                                const uint64_t evaluations,
+                                const double evaluationSeconds) const {
+  printArea(area, standardError);
+
+  //guard against division by zero for extremely small sample counts
+  const double seconds = (0.0 < evaluationSeconds) ? evaluationSeconds : 1e-9;
+  printf("Evaluation time: %.3f ms on %u threads, "
+      "throughput: %.2f Mpoints/s\n", evaluationSeconds * 1000.0,
+      _evaluator.getThreadsCount(), (evaluations / seconds) / 1000000.0);
 }
 
 void Application::updateTexts(
@@ -306,36 +1128,92 @@ void Application::updateTexts(
     return;
   }
 
-  std::string content;
-  content.reserve(50);
+  //formatted in place - no heap allocations
+  char content[Text::MAX_LENGTH + 1];
+  char *const contentEnd = content + Text::MAX_LENGTH;
+  char *pos = nullptr;
+
+  pos = appendText(content, contentEnd, "Time spent: ");
+  pos = std::to_chars(pos, contentEnd,
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          Time::now() - start).count()).ptr;
+  pos = appendText(pos, contentEnd, " ms");
+  *pos = '\0';
+  _texts[Textures::TIME].setText(content);
+
+  pos = appendText(content, contentEnd, "Points: ");
+  pos = std::to_chars(pos, contentEnd, _totalEvaluatedPoints).ptr;
+  *pos = '\0';
+  _texts[Textures::ALL_POINTS].setText(content);
+
+  pos = appendText(content, contentEnd, "Error: ");
+  if (_shape->hasAnalyticArea) {
+    pos = std::to_chars(pos, contentEnd, calculateError(args),
+        std::chars_format::fixed, 3).ptr;
+    pos = appendText(pos, contentEnd, "%");
+  } else {
+    pos = appendText(pos, contentEnd, "n/a");
+  }
+  *pos = '\0';
+  _texts[Textures::ERROR].setText(content);
+}
+
+double Application::calculateStandardError(
+    const MonteCarloArgs &args) const {
+  const double SCALE_AREA = args.animationScale * args.animationScale;
+
+  return (_hitRatioStats.getStandardError() * ovalArea(args.ovalRadius))
+      / SCALE_AREA;
+}
+
+double Application::calculateConfidenceHalfWidth(
+    const MonteCarloArgs &args) const {
+  const double SCALE_AREA = args.animationScale * args.animationScale;
+
+  return (Z_95 * _hitRatioStats.getStandardError()
+      * ovalArea(args.ovalRadius)) / SCALE_AREA;
+}
 
-  content = "Time spent: ";
-  content.append(
-      std::to_string(
-          std::chrono::duration_cast<std::chrono::milliseconds>(
-              Time::now() - start).count()));
-  content.append(" ms");
-  _texts[Textures::TIME].setText(content.c_str());
+bool Application::isConverged(const MonteCarloArgs &args) const {
+  if ( (0.0 >= _ciHalfWidth)
+      || (CONVERGENCE_MIN_SAMPLES > _hitRatioStats.getCount())) {
+    return false;
+  }
+
+  return calculateConfidenceHalfWidth(args) <= _ciHalfWidth;
+}
+
+uint64_t Application::calculateChecksum() const {
+  constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ull;
+  constexpr uint64_t FNV_PRIME = 0x100000001B3ull;
 
-  content = "Points: ";
-  content.append(std::to_string(_totalEvaluatedPoints));
-  _texts[Textures::ALL_POINTS].setText(content.c_str());
+  const uint64_t values[] = { _totalEvaluatedPoints, _pointsInOval,
+      _pointsInBatman };
 
-  content = "Error: ";
+  //hash the values byte by byte in little endian order, so the checksum
+  //does not depend on the host endianness
+  uint64_t hash = FNV_OFFSET_BASIS;
+  for (const uint64_t value : values) {
+    for (int32_t byte = 0; byte < 8; ++byte) {
+      hash ^= (value >> (byte * 8)) & 0xFF;
+      hash *= FNV_PRIME;
+    }
+  }
+
+  return hash;
+}
 
-  std::ostringstream ostr;
-  ostr << std::fixed << std::setprecision(3) << calculateError(args);
+double Application::estimateArea(const MonteCarloArgs &args) const {
+  const double SCALE_AREA = args.animationScale * args.animationScale;
 
-  content.append(ostr.str());
-  content.append("%");
-  _texts[Textures::ERROR].setText(content.c_str());
+  return ( (_pointsInBatman / static_cast<double>(_pointsInOval))
+      * ovalArea(args.ovalRadius)) / SCALE_AREA;
 }
 
 double Application::calculateError(const MonteCarloArgs &args) const {
-  constexpr double MATH_AREA = 48.4243597;
-  static const double REAL_AREA = MATH_AREA * args.animationScale
-                                  * args.animationScale;
-  static const double OVAL_AREA = ovalArea(args.ovalRadius);
+  const double REAL_AREA = _shape->analyticArea * args.animationScale
+                           * args.animationScale;
+  const double OVAL_AREA = ovalArea(args.ovalRadius);
 
   const double AREA_DIFF =
       fabs( ( (_pointsInBatman / static_cast<double>(
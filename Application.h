@@ -7,6 +7,10 @@
 #include <cstdint>
 #include <cmath>
 #include <chrono>
+#include <atomic>
+#include <thread>
+#include <string>
+#include <vector>
 
 //Other libraries headers
 #include <SDL_events.h>
@@ -14,18 +18,133 @@
 //Own components headers
 #include "common/CommonDefines.h"
 #include "common/CommonStructs.hpp"
+#include "common/SpscRingBuffer.hpp"
 
 #include "sdl/Renderer.h"
 #include "sdl/Text.h"
 #include "sdl/FBO.h"
+#include "sdl/PixelBuffer.h"
+
+#include "montecarlo/ParallelEvaluator.h"
+#include "montecarlo/PointGenerator.h"
+#include "montecarlo/RunningStats.h"
+#include "montecarlo/DensityGrid.h"
+#include "montecarlo/StratifiedEstimator.h"
+#include "montecarlo/OccupancyGrid.h"
+#include "montecarlo/PackedPoints.h"
+#include "montecarlo/PartialCounts.h"
+#include "montecarlo/shapes/ShapeFactory.h"
 
 //Forward declarations
 struct Point;
 struct MonteCarloArgs;
 
 struct ApplicationCfg {
-  uint32_t samplesCount = 2000000;
+  uint64_t samplesCount = 2000000;
   bool showTexts = true;
+
+  //evaluate all samples without creating a window or a renderer
+  bool headless = false;
+
+  //worker threads for the headless evaluation. 0 means one per core
+  uint32_t threadsCount = 0;
+
+  //how the sample chunks are distributed across the threads
+  uint8_t schedulingPolicy = SchedulingPolicy::WORK_STEALING;
+
+  //print the per-thread utilization after a headless run
+  bool showWorkerStats = false;
+
+  //ClassifierKernel used by the headless evaluation
+  uint8_t classifierKernel = ClassifierKernel::SIMD;
+
+  //generate the headless samples in small blocks right before their
+  //evaluation instead of storing all of them upfront. Same as
+  //PointStorage::REGENERATE
+  bool streaming = false;
+
+  //MemoryPlacement of the stored samples. FIRST_TOUCH and HUGE_PAGES
+  //leave the pages untouched until the workers generate the samples, so
+  //each page lands on the NUMA node of the worker which evaluates it
+  uint8_t memoryPlacement = MemoryPlacement::DEFAULT;
+
+  //PointStorage of the samples. PACKED keeps 16 bit fixed point
+  //coordinates (4 bytes per sample), REGENERATE keeps nothing and
+  //generates every sample again from its index when it is evaluated
+  uint8_t pointStorage = PointStorage::FULL;
+
+  //SamplerType used to generate the samples
+  uint8_t samplerType = SamplerType::PHILOX;
+
+  //seed of the sampler. Used only when useFixedSeed is set, otherwise
+  //a seed is drawn from std::random_device
+  uint64_t seed = 0;
+  bool useFixedSeed = false;
+
+  //print a checksum of the final counters for comparison between runs
+  bool showChecksum = false;
+
+  //stop as soon as the 95% confidence interval half-width of the
+  //estimated area drops below this value. 0 disables early termination
+  double ciHalfWidth = 0.0;
+
+  //evaluate the samples on a dedicated thread, which hands the points to
+  //draw over a lock-free queue, so the evaluation speed does not depend
+  //on the frame time. When disabled the evaluation and the rendering
+  //alternate on the main thread
+  bool renderPipeline = true;
+
+  //minimum time between two presented frames in interactive mode.
+  //0 means one refresh interval of the display
+  double frameBudgetMs = 0.0;
+
+  //PointsLayer accumulating the points outside of the Batman.
+  //STREAMING avoids the render target switches of the FBO
+  uint8_t pointsLayer = PointsLayer::FBO;
+
+  //interactive mode only. Draw the number of samples which hit every
+  //pixel instead of the points outside of the Batman. The samples are
+  //generated on the fly by threadsCount threads and never stored
+  bool heatmap = false;
+
+  //ShapeType whose area is integrated
+  uint8_t shapeType = ShapeType::BATMAN;
+
+  //SamplingDomain of the generated samples
+  uint8_t samplingDomain = SamplingDomain::WINDOW;
+
+  //headless only. Resolve the grid cells fully inside or outside of the
+  //shape without sampling and spend the samples on the boundary cells
+  bool stratified = false;
+
+  //headless only. Classify the points with a lookup in an OccupancyGrid
+  //and evaluate the shape only near its boundary
+  bool occupancyGrid = false;
+
+  //file caching the OccupancyGrid between runs. Empty disables the cache
+  std::string occupancyCachePath;
+
+  //headless only. Precision of the stored and classified samples. FLOAT
+  //halves the memory traffic and doubles the SIMD lanes, the counters
+  //are accumulated in 64 bit integers in both cases
+  uint8_t precision = Precision::DOUBLE;
+
+  //headless only. Evaluate the same streamed samples in both precisions
+  //and report the difference of the estimates
+  bool comparePrecision = false;
+
+  //headless worker of a distributed integration. Evaluate only the
+  //samples [rangeFirstIdx, rangeFirstIdx + rangeCount) and print their
+  //PartialCounts record instead of the results
+  bool isRangeWorker = false;
+  uint64_t rangeFirstIdx = 0;
+  uint64_t rangeCount = 0;
+
+  //combine PartialCounts records into the final estimate instead of
+  //evaluating any samples. The records are read from the standard input
+  //when partialRecords is empty
+  bool mergePartials = false;
+  std::vector<std::string> partialRecords;
 };
 
 class Application {
@@ -34,26 +153,190 @@ public:
 
   void deinit();
 
-  void start();
+  int32_t start();
 
 private:
   int32_t initGraphics();
 
-  void drawWorld(const std::vector<Point> &outSamples);
+  //integration arguments of the selected shape
+  MonteCarloArgs createArgs() const;
+
+  //uses the refresh interval of the display if frameBudgetMs is 0
+  void initFrameBudget(const double frameBudgetMs);
+
+  void drawWorld(const SDL_Point *outSamples, const int32_t count);
+
+  //reports the heap allocations per frame in steady state. Prints nothing
+  //unless built with BATMAN_COUNT_ALLOCATIONS
+  void printFrameAllocations() const;
 
-  bool isInBatman(const Point &point, const Point &origin,
-                  const double scale) const;
+  //fills the storage of the current precision
+  void generatePoints(const uint64_t maxPoints);
 
-  void generatePoints(const uint32_t windowWidth, const uint32_t windowHeight,
-                      const uint32_t maxPoints);
+  template <typename Real>
+  void generatePoints(const uint64_t maxPoints,
+                      BasicPointsSoA<Real> &outPoints);
+
+  //fills _packedPoints, on all workers when possible
+  void generatePackedPoints(const uint64_t maxPoints);
+
+  /** @brief provides a block of samples of the interactive mode. Stored
+   *         samples are referenced in place, the others are unpacked or
+   *         regenerated into the buffers
+   *
+   *  @param const uint64_t  - index of the first sample
+   *  @param const size_t    - number of samples
+   *  @param double *        - buffer of count x coordinates
+   *  @param double *        - buffer of count y coordinates
+   *  @param const double *& - x coordinates of the block
+   *  @param const double *& - y coordinates of the block
+   * */
+  void loadPointsBlock(const uint64_t firstIdx, const size_t count,
+                       double *bufferXs, double *bufferYs,
+                       const double *&outXs, const double *&outYs);
+
+  //unpacks or regenerates the samples which are not stored in full
+  template <typename Real>
+  void loadPoints(const uint32_t workerId, const uint64_t firstIdx,
+                  const size_t count, Real *outXs, Real *outYs);
 
   void monteCarlo(const MonteCarloArgs args);
 
-  bool inOval(const Point &point, const Point &origin,
-              const Point &ovalRadius) const;
+  /** @brief interactive mode with the evaluation running on a separate
+   *         thread. The main thread renders whatever the evaluation thread
+   *         has produced since the previous frame
+   *
+   *  @param const MonteCarloArgs & - integration arguments
+   * */
+  void monteCarloPipelined(const MonteCarloArgs &args);
+
+  /** @brief body of the evaluation thread of monteCarloPipelined().
+   *         Classifies all points, pushes the ones outside of the target
+   *         to _outSamplesQueue and publishes the counters after each block
+   *
+   *  @param const MonteCarloArgs - integration arguments
+   * */
+  void evaluationLoop(const MonteCarloArgs args);
+
+  /** @brief body of the evaluation thread in heatmap mode. Generates
+   *         and classifies the samples on all workers and counts them in
+   *         _densityGrid
+   *
+   *  @param const MonteCarloArgs - integration arguments
+   * */
+  void heatmapEvaluationLoop(const MonteCarloArgs args);
+
+  //whether the samples are evaluated by the worker threads of _evaluator
+  inline bool isParallel() const {
+    return _headless || _heatmap;
+  }
+
+  //copies the counters published by the evaluation thread
+  void syncPublishedCounters();
+
+  /** @brief evaluates all generated points without any rendering and
+   *         prints the final estimate on the standard output
+   *
+   *  @param const MonteCarloArgs & - integration arguments
+   * */
+  void monteCarloHeadless(const MonteCarloArgs &args);
+
+  /** @brief headless run of the StratifiedEstimator. samplesCount is
+   *         the budget of shape evaluations, probes included
+   *
+   *  @param const MonteCarloArgs & - integration arguments
+   * */
+  void monteCarloStratified(const MonteCarloArgs &args);
+
+  /** @brief evaluates the same streamed samples in double and in single
+   *         precision and prints both results and their difference
+   *
+   *  @param const MonteCarloArgs & - integration arguments
+   * */
+  void monteCarloComparePrecision(const MonteCarloArgs &args);
+
+  /** @brief worker of a distributed integration. Evaluates its sample
+   *         range and prints the PartialCounts record on the standard
+   *         output
+   *
+   *  @param const MonteCarloArgs & - integration arguments
+   * */
+  void monteCarloRange(const MonteCarloArgs &args);
+
+  /** @brief combines the PartialCounts records of the workers and prints
+   *         the final estimate
+   *
+   *  @param const MonteCarloArgs & - integration arguments
+   *
+   *  @returns int32_t              - error code
+   * */
+  int32_t monteCarloMerge(const MonteCarloArgs &args);
+
+  /** @brief evaluates the samples in range [firstIdx, firstIdx + count)
+   *         on all workers. Samples which are not stored in full are
+   *         unpacked or generated block by block
+   *
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param const uint64_t         - index of the first sample
+   *  @param const uint64_t         - number of samples
+   *
+   *  @returns EvaluationCounters   - the counters of the range
+   * */
+  EvaluationCounters evaluateRange(const MonteCarloArgs &args,
+                                   const uint64_t firstIdx,
+                                   const uint64_t count);
+
+  //evaluateRange() in the given precision. The points are used only
+  //with PointStorage::FULL
+  template <typename Real>
+  EvaluationCounters evaluateRange(const MonteCarloArgs &args,
+                                   const BasicPointsSoA<Real> &points,
+                                   const uint64_t firstIdx,
+                                   const uint64_t count);
+
+  void printResults(const MonteCarloArgs &args,
+                    const double evaluationSeconds) const;
+
+  //prints the total, in oval and in shape points counters
+  void printCounters() const;
+
+  /** @brief prints an estimated area, its 95% confidence interval and
+   *         its error against the analytic area of the shape
+   *
+   *  @param const double - estimated area in shape units
+   *  @param const double - standard error of the estimated area
+   * */
+  void printArea(const double area, const double standardError) const;
+
+  /** @brief prints the estimated area as printArea() does, followed by
+   *         the evaluation time and throughput
+   *
+   *  @param const double   - estimated area in shape units
+   *  @param const double   - standard error of the estimated area
+   *  @param const uint64_t - number of shape evaluations
+   *  @param const double   - evaluation time in seconds
+   * */
+  void printEstimate(const double area, const double standardError,
+                     const uint64_t evaluations,
+                     const double evaluationSeconds) const;
 
   double calculateError(const MonteCarloArgs &args) const;
 
+  //standard error of estimateArea()
+  double calculateStandardError(const MonteCarloArgs &args) const;
+
+  //95% confidence interval half-width of estimateArea()
+  double calculateConfidenceHalfWidth(const MonteCarloArgs &args) const;
+
+  //whether the confidence interval target has been reached
+  bool isConverged(const MonteCarloArgs &args) const;
+
+  //FNV-1a hash of the final counters
+  uint64_t calculateChecksum() const;
+
+  //estimated Batman area in the units of the analytic formula
+  double estimateArea(const MonteCarloArgs &args) const;
+
   void updateTexts(const MonteCarloArgs &args,
                    const std::chrono::high_resolution_clock::time_point &start);
 
@@ -73,13 +356,91 @@ private:
 
   FBO _pointsFBO; //frame buffer object
 
-  std::vector<Point> _pointsToEvaluate;
+  //CPU side alternative of _pointsFBO
+  PixelBuffer _pointsPixelBuffer;
+
+  //per-pixel sample counts of the heatmap mode
+  DensityGrid _densityGrid;
+
+  ParallelEvaluator _evaluator;
+
+  StratifiedEstimator _stratifiedEstimator;
+
+  //lookup classification of the headless evaluation
+  OccupancyGrid _occupancyGrid;
 
-  int32_t _totalEvaluatedPoints = 0;
-  int32_t _pointsInOval = 0;
-  int32_t _pointsInBatman = 0;
+  PointGenerator _pointGenerator;
+
+  //kernels of the integrated shape
+  const ShapeKernels *_shape = nullptr;
+
+  PointsSoA _pointsToEvaluate;
+
+  //storage of the headless samples in single precision
+  PointsSoAFloat _pointsToEvaluateFloat;
+
+  //storage of the samples in PointStorage::PACKED mode
+  PackedPoints _packedPoints;
+
+  uint64_t _totalEvaluatedPoints = 0;
+  uint64_t _pointsInOval = 0;
+  uint64_t _pointsInBatman = 0;
+
+  //points outside of the target, produced by the evaluation thread and
+  //consumed by the render thread
+  SpscRingBuffer<SDL_Point> _outSamplesQueue;
+
+  std::thread _evaluationThread;
+
+  //counters written by the evaluation thread and read for the texts
+  std::atomic<uint64_t> _publishedTotalPoints { 0 };
+  std::atomic<uint64_t> _publishedPointsInOval { 0 };
+  std::atomic<uint64_t> _publishedPointsInBatman { 0 };
+
+  //points which were counted, but not drawn because the queue was full
+  std::atomic<uint64_t> _droppedOutSamples { 0 };
+
+  std::atomic<bool> _stopRequested { false };
+  std::atomic<bool> _evaluationFinished { false };
+
+  //running statistics of the in-Batman ratio among the in-oval samples
+  RunningStats _hitRatioStats;
+
+  //presented frames and the allocations count after the first one
+  uint64_t _framesCount = 0;
+  uint64_t _firstFrameAllocations = 0;
+
+  //minimum time between two presented frames
+  std::chrono::nanoseconds _frameBudget { 0 };
+
+  uint64_t _samplesCount = 0;
+  uint64_t _seed = 0;
+
+  //first sample of the range evaluated by a worker process
+  uint64_t _rangeFirstIdx = 0;
+
+  //records combined in merge mode. Empty means the standard input
+  std::vector<std::string> _partialRecords;
+
+  double _ciHalfWidth = 0.0;
 
   bool _showTexts = false;
+  bool _headless = false;
+  bool _showWorkerStats = false;
+  bool _showChecksum = false;
+  bool _renderPipeline = false;
+  bool _heatmap = false;
+  bool _stratified = false;
+  bool _useOccupancyGrid = false;
+  bool _comparePrecision = false;
+  bool _isRangeWorker = false;
+  bool _mergePartials = false;
+
+  uint8_t _precision = Precision::DOUBLE;
+  uint8_t _pointStorage = PointStorage::FULL;
+
+  uint8_t _classifierKernel = ClassifierKernel::SCALAR;
+  uint8_t _pointsLayer = PointsLayer::FBO;
 };
 
 #endif /* APPLICATION_H_ */
@@ -0,0 +1,99 @@
+//Corresponding header
+#include "BenchmarkRunner.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdio>
+#include <chrono>
+#include <thread>
+
+//Other libraries headers
+
+//Own components headers
+
+namespace {
+//sink for the iteration results, so the measured work is not discarded
+volatile uint64_t gSink = 0;
+}
+
+using Time = std::chrono::steady_clock;
+
+void BenchmarkRunner::init(const uint8_t reportFormat,
+                           const double minSeconds) {
+  _reportFormat = reportFormat;
+  _minSeconds = minSeconds;
+}
+
+void BenchmarkRunner::run(const std::string &name,
+                          const std::string &variant, const std::string &mix,
+                          const uint64_t samples, const uint32_t threads,
+                          const Iteration &iteration) {
+  //warm up the caches and the lazily initialized state
+  gSink = gSink + iteration();
+
+  BenchmarkResult result;
+  result.name = name;
+  result.variant = variant;
+  result.mix = mix;
+  result.samples = samples;
+  result.threads = threads;
+
+  const Time::time_point start = Time::now();
+  std::chrono::duration<double> elapsed(0.0);
+  do {
+    gSink = gSink + iteration();
+    ++result.iterations;
+    elapsed = Time::now() - start;
+  } while (elapsed.count() < _minSeconds);
+
+  result.seconds = elapsed.count();
+  result.pointsPerSecond =
+      static_cast<double>(samples * result.iterations) / result.seconds;
+
+  fprintf(stderr, "%-12s %-16s %-12s %10llu samples %3u threads: "
+      "%10.2f Mpoints/s\n", name.c_str(), variant.c_str(), mix.c_str(),
+      static_cast<unsigned long long>(samples), threads,
+      result.pointsPerSecond / 1000000.0);
+
+  _results.push_back(result);
+}
+
+void BenchmarkRunner::report() const {
+  if (ReportFormat::CSV == _reportFormat) {
+    reportCsv();
+  } else {
+    reportJson();
+  }
+}
+
+void BenchmarkRunner::reportJson() const {
+  printf("{\n  \"context\": { \"hardware_threads\": %u },\n"
+      "  \"benchmarks\": [\n", std::thread::hardware_concurrency());
+
+  for (size_t i = 0; i < _results.size(); ++i) {
+    const BenchmarkResult &result = _results[i];
+    printf("    { \"name\": \"%s\", \"variant\": \"%s\", \"mix\": \"%s\", "
+        "\"samples\": %llu, \"threads\": %u, \"iterations\": %llu, "
+        "\"seconds\": %.6f, \"points_per_second\": %.1f }%s\n",
+        result.name.c_str(), result.variant.c_str(), result.mix.c_str(),
+        static_cast<unsigned long long>(result.samples), result.threads,
+        static_cast<unsigned long long>(result.iterations), result.seconds,
+        result.pointsPerSecond, (i + 1 < _results.size()) ? "," : "");
+  }
+
+  printf("  ]\n}\n");
+}
+
+void BenchmarkRunner::reportCsv() const {
+  printf("name,variant,mix,samples,threads,iterations,seconds,"
+      "points_per_second\n");
+
+  for (const BenchmarkResult &result : _results) {
+    printf("%s,%s,%s,%llu,%u,%llu,%.6f,%.1f\n", result.name.c_str(),
+        result.variant.c_str(), result.mix.c_str(),
+        static_cast<unsigned long long>(result.samples), result.threads,
+        static_cast<unsigned long long>(result.iterations), result.seconds,
+        result.pointsPerSecond);
+  }
+}
@@ -0,0 +1,66 @@
+#ifndef BENCHMARK_BENCHMARKRUNNER_H_
+#define BENCHMARK_BENCHMARKRUNNER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+namespace ReportFormat {
+enum : uint8_t {
+  JSON, CSV
+};
+}
+
+struct BenchmarkResult {
+  std::string name;
+  std::string variant;
+  std::string mix;
+  uint64_t samples = 0;
+  uint32_t threads = 1;
+  uint64_t iterations = 0;
+  double seconds = 0.0;
+  double pointsPerSecond = 0.0;
+};
+
+/** @brief repeats every benchmark until the minimum measuring time has
+ *         elapsed and reports the throughput in points per second
+ * */
+class BenchmarkRunner {
+public:
+  //processes all samples once and returns a value that depends on the
+  //work, so the compiler can not optimize it away
+  using Iteration = std::function<uint64_t()>;
+
+  void init(const uint8_t reportFormat, const double minSeconds);
+
+  void run(const std::string &name, const std::string &variant,
+           const std::string &mix, const uint64_t samples,
+           const uint32_t threads, const Iteration &iteration);
+
+  /** @brief prints all collected results on the standard output
+   * */
+  void report() const;
+
+private:
+  void reportJson() const;
+
+  void reportCsv() const;
+
+  std::vector<BenchmarkResult> _results;
+
+  double _minSeconds = 0.0;
+
+  uint8_t _reportFormat = ReportFormat::JSON;
+};
+
+#endif /* BENCHMARK_BENCHMARKRUNNER_H_ */
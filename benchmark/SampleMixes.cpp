@@ -0,0 +1,80 @@
+//Corresponding header
+#include "SampleMixes.h"
+
+//C system headers
+
+//C++ system headers
+#include <cmath>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/BatmanClassifier.h"
+#include "montecarlo/Philox.hpp"
+#include "montecarlo/samplers/SamplerUtils.hpp"
+
+namespace {
+constexpr uint64_t MIX_SEED = 0x5EEDBA75ull;
+
+bool matchesMix(const uint8_t mix, const Point &point,
+                const MonteCarloArgs &args) {
+  const bool inOval = BatmanClassifier::inOval(point, args.animationCenter,
+      args.ovalRadius);
+
+  switch (mix) {
+  case SampleMix::ALL_INSIDE:
+    return inOval && BatmanClassifier::isInBatman(point,
+        args.animationCenter, args.animationScale);
+
+  case SampleMix::ALL_OUTSIDE:
+    return !inOval;
+
+  case SampleMix::WING_HEAVY:
+    return inOval && (3.0 < (fabs(point.x - args.animationCenter.x)
+        / args.animationScale));
+
+  default:
+    return true;
+  }
+}
+}
+
+void SampleMixes::generate(const uint8_t mix, const uint64_t count,
+                           const MonteCarloArgs &args, PointsSoA &outPoints) {
+  outPoints.resize(count);
+
+  const Philox4x32 philox(MIX_SEED + mix);
+  const double width = 2.0 * args.animationCenter.x;
+  const double height = 2.0 * args.animationCenter.y;
+
+  //rejection sampling from the whole window
+  uint64_t counter = 0;
+  for (uint64_t i = 0; i < count; ) {
+    const Philox4x32::Block block = philox.generate(counter++);
+    const Point point(SamplerUtils::toUnitDouble(
+        (static_cast<uint64_t>(block.v[0]) << 32) | block.v[1]) * width,
+        SamplerUtils::toUnitDouble(
+        (static_cast<uint64_t>(block.v[2]) << 32) | block.v[3]) * height);
+
+    if (matchesMix(mix, point, args)) {
+      outPoints.x[i] = point.x;
+      outPoints.y[i] = point.y;
+      ++i;
+    }
+  }
+}
+
+const char* SampleMixes::getName(const uint8_t mix) {
+  switch (mix) {
+  case SampleMix::UNIFORM:
+    return "uniform";
+  case SampleMix::ALL_INSIDE:
+    return "all-inside";
+  case SampleMix::ALL_OUTSIDE:
+    return "all-outside";
+  case SampleMix::WING_HEAVY:
+    return "wing-heavy";
+  default:
+    return "unknown";
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef BENCHMARK_SAMPLEMIXES_H_
+#define BENCHMARK_SAMPLEMIXES_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+
+//region mixes with different per-point classification cost
+namespace SampleMix {
+enum : uint8_t {
+  UNIFORM,     //the whole window, as in a real run
+  ALL_INSIDE,  //inside the Batman shape
+  ALL_OUTSIDE, //outside the oval - early exit in inOval()
+  WING_HEAVY,  //inside the oval and beyond the shoulders (|x| > 3)
+
+  COUNT
+};
+}
+
+class SampleMixes {
+public:
+  ~SampleMixes() = delete;
+
+  /** @brief fills the points with the requested region mix
+   *
+   *  @param const uint8_t          - SampleMix to be generated
+   *  @param const uint64_t         - number of points
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param PointsSoA &            - generated points
+   * */
+  static void generate(const uint8_t mix, const uint64_t count,
+                       const MonteCarloArgs &args, PointsSoA &outPoints);
+
+  static const char* getName(const uint8_t mix);
+};
+
+#endif /* BENCHMARK_SAMPLEMIXES_H_ */
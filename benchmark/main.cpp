@@ -0,0 +1,380 @@
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+//Other libraries headers
+#include <SDL2/SDL_rect.h>
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "common/CommonStructs.hpp"
+#include "montecarlo/BatmanClassifier.h"
+#include "montecarlo/BatchClassifier.h"
+#include "montecarlo/ParallelEvaluator.h"
+#include "montecarlo/PointGenerator.h"
+#include "montecarlo/shapes/BatmanShape.hpp"
+#include "montecarlo/shapes/BatmanSegmentShape.hpp"
+#include "sdl/SDLLoader.h"
+#include "sdl/Renderer.h"
+#include "sdl/FBO.h"
+#include "benchmark/BenchmarkRunner.h"
+#include "benchmark/SampleMixes.h"
+
+namespace {
+//mirror the window and the integration arguments of Application::start()
+constexpr int32_t MONITOR_WIDTH = 1920;
+constexpr int32_t MONITOR_HEIGHT = 1080;
+
+//lattice steps per shape unit of the classifier validation
+constexpr int32_t VALIDATION_STEPS_PER_UNIT = 512;
+
+struct BenchmarkCfg {
+  std::vector<uint64_t> samplesCounts { 1 << 16, 1 << 20 };
+  std::vector<uint32_t> threadsCounts { 1, 2, 4, 8 };
+  double minSeconds = 0.2;
+  uint8_t reportFormat = ReportFormat::JSON;
+  bool benchmarkRender = false;
+  bool validate = false;
+};
+}
+
+static MonteCarloArgs createArgs() {
+  MonteCarloArgs args;
+  args.animationCenter = Point(MONITOR_WIDTH / 2, MONITOR_HEIGHT / 2);
+  args.animationScale = 120.0;
+  args.ovalRadius = Point(MONITOR_WIDTH / 2, MONITOR_WIDTH / 4);
+
+  return args;
+}
+
+template <typename T>
+static std::vector<T> parseList(const std::string &value) {
+  std::vector<T> result;
+  size_t start = 0;
+  while (start < value.size()) {
+    size_t end = value.find(',', start);
+    if (std::string::npos == end) {
+      end = value.size();
+    }
+
+    result.push_back(static_cast<T>(std::stoull(
+        value.substr(start, end - start))));
+    start = end + 1;
+  }
+
+  return result;
+}
+
+static int32_t parseInput(int32_t argc, char *args[], BenchmarkCfg &cfg) {
+  for (int32_t i = 1; i < argc; ++i) {
+    const std::string arg(args[i]);
+
+    try {
+      if (0 == arg.compare(0, 10, "--samples=")) {
+        cfg.samplesCounts = parseList<uint64_t>(arg.substr(10));
+      } else if (0 == arg.compare(0, 10, "--threads=")) {
+        cfg.threadsCounts = parseList<uint32_t>(arg.substr(10));
+      } else if (0 == arg.compare(0, 11, "--min-time=")) {
+        cfg.minSeconds = std::stod(arg.substr(11));
+      } else if ("--format=csv" == arg) {
+        cfg.reportFormat = ReportFormat::CSV;
+      } else if ("--format=json" == arg) {
+        cfg.reportFormat = ReportFormat::JSON;
+      } else if ("--render" == arg) {
+        cfg.benchmarkRender = true;
+      } else if ("--validate" == arg) {
+        cfg.validate = true;
+      } else {
+        fprintf(stderr, "Error, unknown arg: %s\n", arg.c_str());
+
+        return EXIT_FAILURE;
+      }
+    } catch (const std::logic_error &) {
+      fprintf(stderr, "Error, bad value in arg: %s\n", arg.c_str());
+
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+static void benchmarkClassifiers(BenchmarkRunner &runner,
+                                 const BenchmarkCfg &cfg) {
+  const MonteCarloArgs args = createArgs();
+  const bool hasSimd = ClassifierKernel::SIMD ==
+      BatchClassifier::resolveKernel(ClassifierKernel::SIMD);
+  PointsSoA points;
+
+  for (const uint64_t samples : cfg.samplesCounts) {
+    for (uint8_t mix = 0; mix < SampleMix::COUNT; ++mix) {
+      SampleMixes::generate(mix, samples, args, points);
+      const double *xs = points.x.data();
+      const double *ys = points.y.data();
+      const char *mixName = SampleMixes::getName(mix);
+
+      runner.run("inOval", "scalar", mixName, samples, 1, [&]() {
+        uint64_t hits = 0;
+        for (uint64_t i = 0; i < samples; ++i) {
+          hits += BatmanClassifier::inOval(Point(xs[i], ys[i]),
+              args.animationCenter, args.ovalRadius);
+        }
+        return hits;
+      });
+
+      runner.run("isInBatman", "scalar", mixName, samples, 1, [&]() {
+        uint64_t hits = 0;
+        for (uint64_t i = 0; i < samples; ++i) {
+          hits += BatmanClassifier::isInBatman(Point(xs[i], ys[i]),
+              args.animationCenter, args.animationScale);
+        }
+        return hits;
+      });
+
+      for (const uint8_t kernel : { ClassifierKernel::SCALAR,
+          ClassifierKernel::SIMD, ClassifierKernel::SEGMENTS }) {
+        if ( (ClassifierKernel::SIMD == kernel) && !hasSimd) {
+          continue;
+        }
+
+        runner.run("classify", BatchClassifier::getKernelName(kernel),
+            mixName, samples, 1, [&]() {
+              EvaluationCounters counters;
+              BatchClassifier::evaluate(xs, ys, samples, args, kernel,
+                  counters);
+              return counters.pointsInBatman;
+            });
+      }
+    }
+  }
+}
+
+/** @brief compares BatmanSegmentShape against BatmanShape on a dense
+ *         lattice over the bounding box, which includes all segment
+ *         delimiters. Mismatches are expected only within a rounding
+ *         error of the outline
+ *
+ *  @returns int32_t - EXIT_FAILURE if a mismatch is farther away from
+ *                     the outline
+ * */
+static int32_t validateClassifiers() {
+  const int32_t halfWidth =
+      static_cast<int32_t>(BatmanShape::BOUNDING_RADIUS_X)
+      * VALIDATION_STEPS_PER_UNIT;
+  const int32_t halfHeight =
+      static_cast<int32_t>(BatmanShape::BOUNDING_RADIUS_Y)
+      * VALIDATION_STEPS_PER_UNIT;
+  const double step = 1.0 / VALIDATION_STEPS_PER_UNIT;
+
+  //a point is near the outline when a neighbour at a tiny offset is
+  //classified differently by the reference
+  constexpr double OUTLINE_EPSILON = 1e-9;
+
+  uint64_t pointsCount = 0;
+  uint64_t mismatches = 0;
+  uint64_t farMismatches = 0;
+  for (int32_t row = -halfHeight; row <= halfHeight; ++row) {
+    for (int32_t col = -halfWidth; col <= halfWidth; ++col) {
+      const double x = col * step;
+      const double y = row * step;
+      ++pointsCount;
+
+      const bool reference = BatmanShape::contains(x, y);
+      if (reference == BatmanSegmentShape::contains(x, y)) {
+        continue;
+      }
+
+      ++mismatches;
+      const bool isNearOutline =
+          (reference != BatmanShape::contains(x - OUTLINE_EPSILON, y))
+          || (reference != BatmanShape::contains(x + OUTLINE_EPSILON, y))
+          || (reference != BatmanShape::contains(x, y - OUTLINE_EPSILON))
+          || (reference != BatmanShape::contains(x, y + OUTLINE_EPSILON));
+      if (!isNearOutline) {
+        ++farMismatches;
+        fprintf(stderr, "Mismatch away from the outline at (%.9f, %.9f)\n",
+            x, y);
+      }
+    }
+  }
+
+  fprintf(stderr, "Validated the segments kernel on %llu points: "
+      "%llu mismatches on the outline, %llu elsewhere\n",
+      static_cast<unsigned long long>(pointsCount),
+      static_cast<unsigned long long>(mismatches - farMismatches),
+      static_cast<unsigned long long>(farMismatches));
+
+  return (0 == farMismatches) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static void benchmarkGeneration(BenchmarkRunner &runner,
+                                const BenchmarkCfg &cfg) {
+  PointsSoA points;
+
+  for (const uint64_t samples : cfg.samplesCounts) {
+    points.resize(samples);
+
+    for (const uint8_t samplerType : { SamplerType::MT19937,
+        SamplerType::PHILOX, SamplerType::SOBOL, SamplerType::HALTON,
+        SamplerType::R2 }) {
+      PointGenerator generator;
+      if (EXIT_SUCCESS != generator.init(samplerType, 1, MONITOR_WIDTH,
+              MONITOR_HEIGHT, 0)) {
+        continue;
+      }
+
+      runner.run("generate", generator.getSamplerName(), "uniform", samples,
+          1, [&]() {
+            generator.generate(0, 0, samples, points.x.data(),
+                points.y.data());
+            return static_cast<uint64_t>(points.x[samples / 2]);
+          });
+    }
+  }
+}
+
+static void benchmarkEvaluation(BenchmarkRunner &runner,
+                                const BenchmarkCfg &cfg) {
+  const MonteCarloArgs args = createArgs();
+  const uint8_t kernel =
+      BatchClassifier::resolveKernel(ClassifierKernel::SIMD);
+
+  for (const uint32_t threads : cfg.threadsCounts) {
+    for (const uint8_t policy : { SchedulingPolicy::STATIC,
+        SchedulingPolicy::WORK_STEALING }) {
+      ParallelEvaluator evaluator;
+      PointGenerator generator;
+      if ( (EXIT_SUCCESS != evaluator.init(threads, policy))
+          || (EXIT_SUCCESS != generator.init(SamplerType::PHILOX, threads,
+              MONITOR_WIDTH, MONITOR_HEIGHT, 0))) {
+        continue;
+      }
+
+      const char *variant = (SchedulingPolicy::STATIC == policy) ?
+          "stream-static" : "stream-stealing";
+
+      for (const uint64_t samples : cfg.samplesCounts) {
+        runner.run("evaluate", variant, "uniform", samples, threads, [&]() {
+          return evaluator.evaluate(samples,
+              [&](const uint32_t workerId, const uint64_t firstIdx,
+                  const uint64_t count, EvaluationCounters &outCounters) {
+                double xs[STREAM_BLOCK_SIZE];
+                double ys[STREAM_BLOCK_SIZE];
+                for (uint64_t offset = 0; offset < count;
+                    offset += STREAM_BLOCK_SIZE) {
+                  const size_t blockSize = static_cast<size_t>(
+                      std::min<uint64_t>(STREAM_BLOCK_SIZE, count - offset));
+                  generator.generate(workerId, firstIdx + offset, blockSize,
+                      xs, ys);
+                  BatchClassifier::evaluate(xs, ys, blockSize, args, kernel,
+                      outCounters);
+                }
+              }).pointsInBatman;
+        });
+      }
+
+      evaluator.deinit();
+    }
+  }
+}
+
+static int32_t benchmarkRender(BenchmarkRunner &runner,
+                               const BenchmarkCfg &cfg) {
+  if (EXIT_SUCCESS != SDLLoader::init()) {
+    fprintf(stderr, "Error in SDLLoader::init()\n");
+
+    return EXIT_FAILURE;
+  }
+
+  Renderer renderer;
+  FBO pointsFBO;
+  if ( (EXIT_SUCCESS != renderer.init(0, 0, MONITOR_WIDTH, MONITOR_HEIGHT))
+      || (EXIT_SUCCESS != pointsFBO.init(&renderer, Textures::VBO,
+          SDL_Point { 0, 0 }, MONITOR_WIDTH, MONITOR_HEIGHT))) {
+    fprintf(stderr, "Error, renderer initialization failed\n");
+    renderer.deinit();
+    SDLLoader::deinit();
+
+    return EXIT_FAILURE;
+  }
+
+  const MonteCarloArgs args = createArgs();
+  PointsSoA points;
+  std::vector<SDL_Point> sdlPoints;
+
+  for (const uint64_t samples : cfg.samplesCounts) {
+    SampleMixes::generate(SampleMix::UNIFORM, samples, args, points);
+    sdlPoints.resize(samples);
+    for (uint64_t i = 0; i < samples; ++i) {
+      sdlPoints[i].x = static_cast<int32_t>(points.x[i]);
+      sdlPoints[i].y = static_cast<int32_t>(points.y[i]);
+    }
+
+    //all points in a single call
+    runner.run("drawPoints", "single-batch", "uniform", samples, 1, [&]() {
+      pointsFBO.unlockFBO();
+      renderer.drawPoints(sdlPoints.data(), static_cast<int32_t>(samples));
+      pointsFBO.lockFBO();
+      return samples;
+    });
+
+    //a full frame with every point collected during one frame budget,
+    //as the interactive mode presents it
+    runner.run("drawPoints", "frame-per-budget", "uniform", samples, 1,
+        [&]() {
+          renderer.clearScreen();
+          pointsFBO.unlockFBO();
+          renderer.drawPoints(sdlPoints.data(),
+              static_cast<int32_t>(samples));
+          pointsFBO.lockFBO();
+          renderer.drawTexture(&pointsFBO.drawParams);
+          renderer.finishFrame();
+          return samples;
+        });
+  }
+
+  renderer.deinit();
+  SDLLoader::deinit();
+
+  return EXIT_SUCCESS;
+}
+
+int32_t main(int32_t argc, char *args[]) {
+  BenchmarkCfg cfg;
+  if (EXIT_SUCCESS != parseInput(argc, args, cfg)) {
+    fprintf(stderr, "Usage: batman_benchmark [--samples=N,M,...] "
+        "[--threads=N,M,...] [--min-time=seconds] [--format=json|csv] "
+        "[--render] [--validate]\n");
+
+    return EXIT_FAILURE;
+  }
+
+  if (cfg.validate) {
+    return validateClassifiers();
+  }
+
+  BenchmarkRunner runner;
+  runner.init(cfg.reportFormat, cfg.minSeconds);
+
+  benchmarkClassifiers(runner, cfg);
+  benchmarkGeneration(runner, cfg);
+  benchmarkEvaluation(runner, cfg);
+
+  if (cfg.benchmarkRender && (EXIT_SUCCESS != benchmarkRender(runner, cfg))) {
+    fprintf(stderr, "benchmarkRender() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  runner.report();
+
+  return EXIT_SUCCESS;
+}
@@ -53,3 +53,29 @@ function(enable_target_warnings target)
         )
     endif()
 endfunction()
+
+function(link_target_sdl target)
+    target_include_directories(
+        ${target}
+            PRIVATE
+                ${SDL2_INCLUDE_DIR}
+                ${SDL2_IMAGE_INCLUDE_DIR}
+                ${SDL2_TTF_INCLUDE_DIR}
+    )
+
+    target_link_libraries(
+        ${target}
+            PRIVATE
+                ${SDL2_LIBRARY}       # -lSDL2 flag
+                ${SDL2_IMAGE_LIBRARY} # -lSDL2_image flag
+                ${SDL2_TTF_LIBRARY}   # -lSDL2_ttf flag
+    )
+
+    if(CMAKE_CXX_COMPILER_ID MATCHES Clang)
+        target_link_libraries(
+            ${target}
+                PRIVATE
+                    stdc++            # -libstdc++ flag
+        )
+    endif()
+endfunction()
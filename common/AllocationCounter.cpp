@@ -0,0 +1,151 @@
+//Corresponding header
+#include "AllocationCounter.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <atomic>
+#include <new>
+
+//Other libraries headers
+
+//Own components headers
+
+#ifdef BATMAN_COUNT_ALLOCATIONS
+
+namespace {
+std::atomic<uint64_t> gAllocationsCount { 0 };
+
+void* countedAlloc(const size_t size) {
+  gAllocationsCount.fetch_add(1, std::memory_order_relaxed);
+
+  //operator new must return a unique pointer even for 0 bytes
+  return std::malloc((0 == size) ? 1 : size);
+}
+
+void* countedAlignedAlloc(const size_t size, const std::align_val_t align) {
+  gAllocationsCount.fetch_add(1, std::memory_order_relaxed);
+
+  //aligned_alloc() requires a size, which is a multiple of the alignment
+  const size_t alignment = static_cast<size_t>(align);
+  const size_t alignedSize =
+      ((((0 == size) ? 1 : size) + alignment - 1) / alignment) * alignment;
+
+  return std::aligned_alloc(alignment, alignedSize);
+}
+}
+
+void* operator new(size_t size) {
+  void *ptr = countedAlloc(size);
+  if (nullptr == ptr) {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return countedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return countedAlloc(size);
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+  void *ptr = countedAlignedAlloc(size, align);
+  if (nullptr == ptr) {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t align) {
+  return operator new(size, align);
+}
+
+void* operator new(size_t size, std::align_val_t align,
+                   const std::nothrow_t&) noexcept {
+  return countedAlignedAlloc(size, align);
+}
+
+void* operator new[](size_t size, std::align_val_t align,
+                     const std::nothrow_t&) noexcept {
+  return countedAlignedAlloc(size, align);
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t,
+                     const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t,
+                       const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+bool AllocationCounter::isEnabled() {
+  return true;
+}
+
+uint64_t AllocationCounter::getAllocationsCount() {
+  return gAllocationsCount.load(std::memory_order_relaxed);
+}
+
+#else /* BATMAN_COUNT_ALLOCATIONS */
+
+bool AllocationCounter::isEnabled() {
+  return false;
+}
+
+uint64_t AllocationCounter::getAllocationsCount() {
+  return 0;
+}
+
+#endif /* BATMAN_COUNT_ALLOCATIONS */
@@ -0,0 +1,32 @@
+#ifndef COMMON_ALLOCATIONCOUNTER_H_
+#define COMMON_ALLOCATIONCOUNTER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief counts the calls to the global operator new (all threads).
+ *         The operators are replaced only when the project is configured
+ *         with -DBATMAN_COUNT_ALLOCATIONS=ON, so regular builds pay nothing.
+ *         Allocations done by C libraries with malloc() are not counted
+ * */
+class AllocationCounter {
+public:
+  AllocationCounter() = delete;
+  ~AllocationCounter() = delete;
+
+  //whether the global operator new is instrumented in this build
+  static bool isEnabled();
+
+  //number of allocations since the start of the program. 0 if disabled
+  static uint64_t getAllocationsCount();
+};
+
+#endif /* COMMON_ALLOCATIONCOUNTER_H_ */
@@ -4,6 +4,7 @@
 //C system headers
 
 //C++ system headers
+#include <cstddef>
 #include <cstdint>
 
 //Other libraries headers
@@ -14,7 +15,7 @@
 
 namespace Textures {
 enum : uint8_t {
-  TIME, ALL_POINTS, ERROR, VBO,
+  TIME, ALL_POINTS, ERROR, VBO, SMALL_GLYPHS, BIG_GLYPHS,
 
   COUNT, TEXTS_COUNT = 3
 };
@@ -26,5 +27,74 @@ enum {
 };
 }
 
+namespace SchedulingPolicy {
+enum : uint8_t {
+  STATIC, WORK_STEALING
+};
+}
+
+namespace ClassifierKernel {
+enum : uint8_t {
+  SCALAR, SIMD, SEGMENTS
+};
+}
+
+namespace SamplerType {
+enum : uint8_t {
+  MT19937, PHILOX, SOBOL, HALTON, R2
+};
+}
+
+namespace PointsLayer {
+enum : uint8_t {
+  FBO, STREAMING
+};
+}
+
+namespace ShapeType {
+enum : uint8_t {
+  BATMAN, ELLIPSE, ANNULUS, HEART
+};
+}
+
+//region in which the samples are uniformly distributed
+namespace SamplingDomain {
+enum : uint8_t {
+  WINDOW, ELLIPSE
+};
+}
+
+//where the large sample buffers are allocated. See PageAllocator
+namespace MemoryPlacement {
+enum : uint8_t {
+  DEFAULT, FIRST_TOUCH, HUGE_PAGES
+};
+}
+
+//how the samples are kept between their generation and their evaluation
+namespace PointStorage {
+enum : uint8_t {
+  FULL, PACKED, REGENERATE
+};
+}
+
+//floating point type of the stored and classified samples
+namespace Precision {
+enum : uint8_t {
+  DOUBLE, FLOAT
+};
+}
+
+//classification of a sample against the integrated shape
+namespace PointRegion {
+enum : uint8_t {
+  OUT_OF_BOUNDS, OUTSIDE_SHAPE, INSIDE_SHAPE
+};
+}
+
+//points generated and classified at once in streaming mode.
+//The x and y blocks together occupy 16 KB, so they stay in L1
+constexpr size_t STREAM_BLOCK_SIZE = 1024;
+
 #endif /* COMMON_COMMONDEFINES_H_ */
 
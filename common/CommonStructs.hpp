@@ -5,10 +5,13 @@
 
 //C++ system headers
 #include <cstdint>
+#include <cstddef>
+#include <vector>
 
 //Other libraries headers
 
 //Own components headers
+#include "common/SampleAllocator.hpp"
 
 //Forward declarations
 
@@ -26,10 +29,57 @@ struct Point {
   double y;
 };
 
+//structure-of-arrays point storage. The coordinates live in separate
+//continuous arrays, so they can be loaded directly into SIMD registers
+template <typename Real>
+struct BasicPointsSoA {
+  using Coordinates = std::vector<Real, SampleAllocator<Real>>;
+
+  //selects the MemoryPlacement of the coordinates. Drops the stored points
+  void setPlacement(const uint8_t placement) {
+    x = Coordinates(SampleAllocator<Real>(placement));
+    y = Coordinates(SampleAllocator<Real>(placement));
+  }
+
+  void resize(const size_t count) {
+    x.resize(count);
+    y.resize(count);
+  }
+
+  inline Point operator[](const size_t idx) const {
+    return Point(x[idx], y[idx]);
+  }
+
+  inline size_t size() const {
+    return x.size();
+  }
+
+  Coordinates x;
+  Coordinates y;
+};
+
+using PointsSoA = BasicPointsSoA<double>;
+
+//half of the memory of PointsSoA. Pixel coordinates of the window keep
+//a precision of about 1e-4 pixels in a float
+using PointsSoAFloat = BasicPointsSoA<float>;
+
 struct MonteCarloArgs {
   Point animationCenter;
   double animationScale;
   Point ovalRadius;
 };
 
+struct EvaluationCounters {
+  void merge(const EvaluationCounters &other) {
+    totalPoints += other.totalPoints;
+    pointsInOval += other.pointsInOval;
+    pointsInBatman += other.pointsInBatman;
+  }
+
+  uint64_t totalPoints = 0;
+  uint64_t pointsInOval = 0;
+  uint64_t pointsInBatman = 0;
+};
+
 #endif /* COMMON_COMMONSTRUCTS_HPP_ */
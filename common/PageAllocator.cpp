@@ -0,0 +1,99 @@
+//Corresponding header
+#include "PageAllocator.h"
+
+//C system headers
+#ifdef __linux__
+#include <sys/mman.h>
+#endif /* __linux__ */
+
+//C++ system headers
+#include <cstdio>
+#include <new>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+
+#ifdef __linux__
+namespace {
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+size_t roundToHugePages(const size_t bytes) {
+  return ((bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+}
+
+void* mapPages(const size_t bytes, const int32_t extraFlags) {
+  void *memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS | extraFlags, -1, 0);
+
+  return (MAP_FAILED == memory) ? nullptr : memory;
+}
+
+//transparent huge pages cover only the 2 MB aligned parts of a mapping,
+//so a bigger mapping is made and trimmed to an aligned one
+void* mapTransparentHugePages(const size_t bytes) {
+  const size_t mappedBytes = bytes + HUGE_PAGE_SIZE;
+  char *mapping = static_cast<char*>(mapPages(mappedBytes, 0));
+  if (nullptr == mapping) {
+    return nullptr;
+  }
+
+  const uintptr_t address = reinterpret_cast<uintptr_t>(mapping);
+  char *aligned = mapping + (roundToHugePages(address) - address);
+  const size_t headBytes = static_cast<size_t>(aligned - mapping);
+  if (0 < headBytes) {
+    munmap(mapping, headBytes);
+  }
+  munmap(aligned + bytes, mappedBytes - headBytes - bytes);
+
+  if (0 != madvise(aligned, bytes, MADV_HUGEPAGE)) {
+    fprintf(stderr, "Warning, transparent huge pages are not available. "
+        "Using regular pages\n");
+  }
+
+  return aligned;
+}
+}
+#endif /* __linux__ */
+
+void* PageAllocator::allocate(const size_t bytes, const uint8_t placement) {
+#ifdef __linux__
+  if ((MemoryPlacement::DEFAULT != placement) && (0 < bytes)) {
+    void *memory = nullptr;
+    if (MemoryPlacement::HUGE_PAGES == placement) {
+      const size_t hugeBytes = roundToHugePages(bytes);
+      memory = mapPages(hugeBytes, MAP_HUGETLB);
+      if (nullptr == memory) {
+        memory = mapTransparentHugePages(hugeBytes);
+      }
+    } else {
+      memory = mapPages(bytes, 0);
+    }
+
+    if (nullptr == memory) {
+      throw std::bad_alloc();
+    }
+
+    return memory;
+  }
+#endif /* __linux__ */
+
+  (void)placement;
+  return ::operator new(bytes);
+}
+
+void PageAllocator::deallocate(void *memory, const size_t bytes,
+                               const uint8_t placement) {
+#ifdef __linux__
+  if ((MemoryPlacement::DEFAULT != placement) && (0 < bytes)) {
+    munmap(memory, (MemoryPlacement::HUGE_PAGES == placement) ?
+        roundToHugePages(bytes) : bytes);
+    return;
+  }
+#endif /* __linux__ */
+
+  (void)bytes;
+  (void)placement;
+  ::operator delete(memory);
+}
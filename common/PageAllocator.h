@@ -0,0 +1,51 @@
+#ifndef COMMON_PAGEALLOCATOR_H_
+#define COMMON_PAGEALLOCATOR_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief allocates the large sample buffers according to their
+ *         MemoryPlacement.
+ *
+ *         DEFAULT uses the global operator new. FIRST_TOUCH maps fresh
+ *         anonymous pages, which the kernel places on the NUMA node of the
+ *         thread that writes them first. HUGE_PAGES in addition backs the
+ *         buffer with 2 MB pages - explicit ones (MAP_HUGETLB) when the
+ *         system has a reserved pool, transparent ones (MADV_HUGEPAGE)
+ *         otherwise. The placements other than DEFAULT need Linux and
+ *         fall back to DEFAULT elsewhere
+ * */
+class PageAllocator {
+public:
+  PageAllocator() = delete;
+  ~PageAllocator() = delete;
+
+  /** @brief allocates uninitialized memory
+   *
+   *  @param const size_t  - size in bytes
+   *  @param const uint8_t - MemoryPlacement of the memory
+   *
+   *  @returns void *      - the memory. Throws std::bad_alloc on failure
+   * */
+  static void* allocate(const size_t bytes, const uint8_t placement);
+
+  /** @brief releases memory returned by allocate()
+   *
+   *  @param void *        - the memory
+   *  @param const size_t  - size in bytes passed to allocate()
+   *  @param const uint8_t - MemoryPlacement passed to allocate()
+   * */
+  static void deallocate(void *memory, const size_t bytes,
+                         const uint8_t placement);
+};
+
+#endif /* COMMON_PAGEALLOCATOR_H_ */
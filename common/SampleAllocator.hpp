@@ -0,0 +1,93 @@
+#ifndef COMMON_SAMPLEALLOCATOR_HPP_
+#define COMMON_SAMPLEALLOCATOR_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "common/PageAllocator.h"
+
+//Forward declarations
+
+/** @brief std allocator of the sample buffers, which places them through
+ *         the PageAllocator.
+ *
+ *         With any MemoryPlacement other than DEFAULT the elements added
+ *         by resize() are left uninitialized instead of being zeroed, so
+ *         no page is touched until the workers generate the samples into
+ *         their own ranges. Every page is then placed on the NUMA node of
+ *         the worker which generated it - the same worker which evaluates
+ *         it under the same chunk distribution
+ * */
+template <typename T>
+class SampleAllocator {
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  SampleAllocator() = default;
+
+  explicit SampleAllocator(const uint8_t placement)
+      : _placement(placement) {
+  }
+
+  template <typename U>
+  SampleAllocator(const SampleAllocator<U> &other)
+      : _placement(other.getPlacement()) {
+  }
+
+  T* allocate(const size_t count) {
+    return static_cast<T*>(PageAllocator::allocate(count * sizeof (T),
+        _placement));
+  }
+
+  void deallocate(T *memory, const size_t count) {
+    PageAllocator::deallocate(memory, count * sizeof (T), _placement);
+  }
+
+  template <typename U>
+  void construct(U *memory) {
+    if (MemoryPlacement::DEFAULT == _placement) {
+      ::new (static_cast<void*>(memory)) U();
+    } else {
+      ::new (static_cast<void*>(memory)) U;
+    }
+  }
+
+  template <typename U, typename ... Args>
+  void construct(U *memory, Args &&... args) {
+    ::new (static_cast<void*>(memory)) U(std::forward<Args>(args)...);
+  }
+
+  inline uint8_t getPlacement() const {
+    return _placement;
+  }
+
+private:
+  uint8_t _placement = MemoryPlacement::DEFAULT;
+};
+
+template <typename T, typename U>
+bool operator==(const SampleAllocator<T> &left,
+                const SampleAllocator<U> &right) {
+  return left.getPlacement() == right.getPlacement();
+}
+
+template <typename T, typename U>
+bool operator!=(const SampleAllocator<T> &left,
+                const SampleAllocator<U> &right) {
+  return !(left == right);
+}
+
+#endif /* COMMON_SAMPLEALLOCATOR_HPP_ */
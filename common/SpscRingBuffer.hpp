@@ -0,0 +1,126 @@
+#ifndef COMMON_SPSCRINGBUFFER_HPP_
+#define COMMON_SPSCRINGBUFFER_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief bounded lock-free queue for exactly one producer thread and
+ *         exactly one consumer thread.
+ *
+ *         The head and the tail are monotonic counters - the slot of an
+ *         element is (counter & mask), so the capacity is always a power
+ *         of two. Each side keeps a private copy of the counter of the
+ *         other side and reloads the shared atomic only when that copy
+ *         says the queue is full/empty, so in the common case a push or a
+ *         pop touches only the cache line of its own side.
+ * */
+template <typename T>
+class SpscRingBuffer {
+public:
+  /** @brief allocates the storage. Not thread safe - must be called
+   *         before the producer and the consumer are started
+   *
+   *  @param const size_t - requested capacity. Rounded up to the next
+   *                        power of two
+   *
+   *  @returns int32_t    - error code
+   * */
+  int32_t init(const size_t capacity) {
+    if (0 == capacity) {
+      return EXIT_FAILURE;
+    }
+
+    size_t roundedCapacity = 1;
+    while (roundedCapacity < capacity) {
+      roundedCapacity <<= 1;
+    }
+
+    _buffer.resize(roundedCapacity);
+    _mask = roundedCapacity - 1;
+    _head.store(0, std::memory_order_relaxed);
+    _tail.store(0, std::memory_order_relaxed);
+    _cachedHead = 0;
+    _cachedTail = 0;
+
+    return EXIT_SUCCESS;
+  }
+
+  /** @brief adds an element. Called only from the producer thread
+   *
+   *  @param const T & - the element
+   *
+   *  @returns bool    - false if the queue is full (nothing is added)
+   * */
+  bool tryPush(const T &item) {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _cachedHead == _buffer.size()) {
+      _cachedHead = _head.load(std::memory_order_acquire);
+      if (tail - _cachedHead == _buffer.size()) {
+        return false;
+      }
+    }
+
+    _buffer[tail & _mask] = item;
+    _tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /** @brief removes up to maxCount elements in FIFO order.
+   *         Called only from the consumer thread
+   *
+   *  @param T *          - destination of the elements
+   *  @param const size_t - maximum number of elements to remove
+   *
+   *  @returns size_t     - number of removed elements
+   * */
+  size_t popBulk(T *outItems, const size_t maxCount) {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    if (head == _cachedTail) {
+      _cachedTail = _tail.load(std::memory_order_acquire);
+    }
+
+    const size_t count = std::min(_cachedTail - head, maxCount);
+    for (size_t i = 0; i < count; ++i) {
+      outItems[i] = _buffer[(head + i) & _mask];
+    }
+    _head.store(head + count, std::memory_order_release);
+
+    return count;
+  }
+
+  inline size_t capacity() const {
+    return _buffer.size();
+  }
+
+private:
+  enum InternalDefines {
+    CACHE_LINE_SIZE = 64
+  };
+
+  std::vector<T> _buffer;
+  size_t _mask = 0;
+
+  //consumer side
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> _head { 0 };
+  size_t _cachedTail = 0;
+
+  //producer side
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail { 0 };
+  size_t _cachedHead = 0;
+};
+
+#endif /* COMMON_SPSCRINGBUFFER_HPP_ */
@@ -1,11 +1,21 @@
 //C system headers
+#ifdef __linux__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif /* __linux__ */
 
 //C++ system headers
 #include <cstdint>
 #include <cstdlib>
 #include <cstdio>
+#include <cstring>
 #include <string>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+#include <random>
+#include <thread>
+#include <algorithm>
 
 //Other libraries headers
 #include "sdl/SDLLoader.h"
@@ -13,23 +23,289 @@
 //Own components headers
 #include "Application.h"
 
-static ApplicationCfg parseInput(int32_t argc, char *args[]) {
-  ApplicationCfg cfg;
-  if (1 == argc) {
-    return cfg;
+//extracts the value of a "--name=value" argument
+static bool parseValue(const std::string &arg, const char *prefix,
+                       std::string &outValue) {
+  const size_t prefixLen = strlen(prefix);
+  if (0 != arg.compare(0, prefixLen, prefix)) {
+    return false;
   }
 
-  try {
-    cfg.samplesCount = static_cast<uint32_t>(std::stoi(args[1]));
-  } catch(const std::invalid_argument & ex) {
-    fprintf(stderr, "Error, bad args provided. Second parameter should be "
-        "a number. Using the default config number\n");
+  outValue = arg.substr(prefixLen);
+  return true;
+}
+
+static bool parseSamplerType(const std::string &name, uint8_t &outType) {
+  const std::pair<const char*, uint8_t> SAMPLERS[] = {
+      { "mt19937", SamplerType::MT19937 },
+      { "philox", SamplerType::PHILOX },
+      { "sobol", SamplerType::SOBOL },
+      { "halton", SamplerType::HALTON },
+      { "r2", SamplerType::R2 } };
 
-    cfg.showTexts = (std::string(args[1]) == "--show-texts=no") ? false : true;
+  for (const auto &sampler : SAMPLERS) {
+    if (name == sampler.first) {
+      outType = sampler.second;
+      return true;
+    }
   }
 
-  if (3 == argc) {
-    cfg.showTexts = (std::string(args[2]) == "--show-texts=no") ? false : true;
+  return false;
+}
+
+static bool parseShapeType(const std::string &name, uint8_t &outType) {
+  const std::pair<const char*, uint8_t> SHAPES[] = {
+      { "batman", ShapeType::BATMAN },
+      { "ellipse", ShapeType::ELLIPSE },
+      { "annulus", ShapeType::ANNULUS },
+      { "heart", ShapeType::HEART } };
+
+  for (const auto &shape : SHAPES) {
+    if (name == shape.first) {
+      outType = shape.second;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//extracts "start:count" of the --range argument
+static bool parseRange(const std::string &range, uint64_t &outFirstIdx,
+                       uint64_t &outCount) {
+  const size_t separator = range.find(':');
+  if (std::string::npos == separator) {
+    return false;
+  }
+
+  outFirstIdx = std::stoull(range.substr(0, separator));
+  outCount = std::stoull(range.substr(separator + 1));
+  return true;
+}
+
+static ApplicationCfg parseInput(int32_t argc, char *args[],
+                                 uint32_t &outProcessesCount) {
+  ApplicationCfg cfg;
+  std::string value;
+
+  for (int32_t i = 1; i < argc; ++i) {
+    const std::string arg(args[i]);
+
+    if ("--show-texts=no" == arg) {
+      cfg.showTexts = false;
+      continue;
+    }
+
+    if ("--show-texts=yes" == arg) {
+      cfg.showTexts = true;
+      continue;
+    }
+
+    if ("--pipeline=no" == arg) {
+      cfg.renderPipeline = false;
+      continue;
+    }
+
+    if ("--pipeline=yes" == arg) {
+      cfg.renderPipeline = true;
+      continue;
+    }
+
+    if ("--points-layer=fbo" == arg) {
+      cfg.pointsLayer = PointsLayer::FBO;
+      continue;
+    }
+
+    if ("--points-layer=streaming" == arg) {
+      cfg.pointsLayer = PointsLayer::STREAMING;
+      continue;
+    }
+
+    if ("--heatmap" == arg) {
+      cfg.heatmap = true;
+      continue;
+    }
+
+    if ("--domain=window" == arg) {
+      cfg.samplingDomain = SamplingDomain::WINDOW;
+      continue;
+    }
+
+    if ("--domain=ellipse" == arg) {
+      cfg.samplingDomain = SamplingDomain::ELLIPSE;
+      continue;
+    }
+
+    if ("--stratified" == arg) {
+      cfg.stratified = true;
+      continue;
+    }
+
+    if ("--occupancy-grid" == arg) {
+      cfg.occupancyGrid = true;
+      continue;
+    }
+
+    if ("--merge" == arg) {
+      cfg.mergePartials = true;
+      cfg.headless = true;
+      continue;
+    }
+
+    if ("--headless" == arg) {
+      cfg.headless = true;
+      continue;
+    }
+
+    if ("--scheduler=static" == arg) {
+      cfg.schedulingPolicy = SchedulingPolicy::STATIC;
+      continue;
+    }
+
+    if ("--scheduler=stealing" == arg) {
+      cfg.schedulingPolicy = SchedulingPolicy::WORK_STEALING;
+      continue;
+    }
+
+    if ("--kernel=scalar" == arg) {
+      cfg.classifierKernel = ClassifierKernel::SCALAR;
+      continue;
+    }
+
+    if ("--kernel=simd" == arg) {
+      cfg.classifierKernel = ClassifierKernel::SIMD;
+      continue;
+    }
+
+    if ("--kernel=segments" == arg) {
+      cfg.classifierKernel = ClassifierKernel::SEGMENTS;
+      continue;
+    }
+
+    if ("--precision=double" == arg) {
+      cfg.precision = Precision::DOUBLE;
+      continue;
+    }
+
+    if ("--precision=float" == arg) {
+      cfg.precision = Precision::FLOAT;
+      continue;
+    }
+
+    if ("--compare-precision" == arg) {
+      cfg.comparePrecision = true;
+      continue;
+    }
+
+    if ("--point-storage=full" == arg) {
+      cfg.pointStorage = PointStorage::FULL;
+      continue;
+    }
+
+    if ("--point-storage=packed" == arg) {
+      cfg.pointStorage = PointStorage::PACKED;
+      continue;
+    }
+
+    if ("--point-storage=regenerate" == arg) {
+      cfg.pointStorage = PointStorage::REGENERATE;
+      continue;
+    }
+
+    if ("--memory-placement=default" == arg) {
+      cfg.memoryPlacement = MemoryPlacement::DEFAULT;
+      continue;
+    }
+
+    if ("--memory-placement=first-touch" == arg) {
+      cfg.memoryPlacement = MemoryPlacement::FIRST_TOUCH;
+      continue;
+    }
+
+    if ("--memory-placement=huge-pages" == arg) {
+      cfg.memoryPlacement = MemoryPlacement::HUGE_PAGES;
+      continue;
+    }
+
+    if ("--streaming" == arg) {
+      cfg.streaming = true;
+      continue;
+    }
+
+    if ("--checksum" == arg) {
+      cfg.showChecksum = true;
+      continue;
+    }
+
+    if ("--worker-stats" == arg) {
+      cfg.showWorkerStats = true;
+      continue;
+    }
+
+    if (parseValue(arg, "--occupancy-cache=", value)) {
+      cfg.occupancyGrid = true;
+      cfg.occupancyCachePath = value;
+      continue;
+    }
+
+    if (parseValue(arg, "--shape=", value)) {
+      if (!parseShapeType(value, cfg.shapeType)) {
+        fprintf(stderr, "Error, unknown shape: %s. Ignoring it\n",
+            value.c_str());
+      }
+      continue;
+    }
+
+    if (parseValue(arg, "--sampler=", value)) {
+      if (!parseSamplerType(value, cfg.samplerType)) {
+        fprintf(stderr, "Error, unknown sampler: %s. Ignoring it\n",
+            value.c_str());
+      }
+      continue;
+    }
+
+    try {
+      if (parseValue(arg, "--threads=", value)) {
+        cfg.threadsCount = static_cast<uint32_t>(std::stoul(value));
+        continue;
+      }
+
+      if (parseValue(arg, "--ci-halfwidth=", value)) {
+        cfg.ciHalfWidth = std::stod(value);
+        continue;
+      }
+
+      if (parseValue(arg, "--frame-budget-ms=", value)) {
+        cfg.frameBudgetMs = std::stod(value);
+        continue;
+      }
+
+      if (parseValue(arg, "--range=", value)) {
+        if (!parseRange(value, cfg.rangeFirstIdx, cfg.rangeCount)) {
+          throw std::invalid_argument("missing ':'");
+        }
+        cfg.isRangeWorker = true;
+        cfg.headless = true;
+        continue;
+      }
+
+      if (parseValue(arg, "--processes=", value)) {
+        outProcessesCount = static_cast<uint32_t>(std::stoul(value));
+        cfg.headless = true;
+        continue;
+      }
+
+      if (parseValue(arg, "--seed=", value)) {
+        cfg.seed = std::stoull(value);
+        cfg.useFixedSeed = true;
+        continue;
+      }
+
+      cfg.samplesCount = std::stoull(arg);
+    } catch (const std::logic_error &) {
+      fprintf(stderr, "Error, bad arg provided: %s. Ignoring it\n",
+          arg.c_str());
+    }
   }
 
   return cfg;
@@ -44,30 +320,134 @@ static int32_t runApplication(const ApplicationCfg& cfg) {
     return EXIT_FAILURE;
   }
 
-  app.start();
+  const int32_t status = app.start();
 
   app.deinit();
 
-  return EXIT_SUCCESS;
+  return status;
+}
+
+/** @brief splits the samples into equal ranges, evaluates every range in
+ *         a forked worker process and merges the PartialCounts records,
+ *         which the workers write into pipes
+ * */
+static int32_t runLocalProcesses(ApplicationCfg cfg,
+                                 const uint32_t processesCount) {
+#ifdef __linux__
+  //all ranges must come from the same sample sequence
+  if (!cfg.useFixedSeed) {
+    std::random_device rd;
+    cfg.seed = (static_cast<uint64_t>(rd()) << 32) | rd();
+    cfg.useFixedSeed = true;
+  }
+
+  //the processes share the cores instead of each taking all of them
+  if (0 == cfg.threadsCount) {
+    cfg.threadsCount = std::max(1u,
+        std::thread::hardware_concurrency() / processesCount);
+  }
+
+  std::vector<pid_t> workers;
+  std::vector<int32_t> pipes;
+  const uint64_t samplesCount = cfg.samplesCount;
+  //buffered output would be written once more by every child
+  fflush(stdout);
+
+  for (uint32_t i = 0; i < processesCount; ++i) {
+    int32_t fds[2];
+    if (0 != pipe(fds)) {
+      perror("pipe");
+      break;
+    }
+
+    const pid_t pid = fork();
+    if (0 == pid) {
+      close(fds[0]);
+      dup2(fds[1], STDOUT_FILENO);
+      close(fds[1]);
+
+      ApplicationCfg workerCfg = cfg;
+      workerCfg.isRangeWorker = true;
+      workerCfg.rangeFirstIdx = (samplesCount * i) / processesCount;
+      workerCfg.rangeCount =
+          ((samplesCount * (i + 1)) / processesCount) - workerCfg.rangeFirstIdx;
+      const int32_t status = runApplication(workerCfg);
+      fflush(stdout);
+      _exit(status);
+    }
+
+    close(fds[1]);
+    if (0 > pid) {
+      perror("fork");
+      close(fds[0]);
+      break;
+    }
+
+    workers.push_back(pid);
+    pipes.push_back(fds[0]);
+  }
+
+  //the records are short, so no worker blocks on a full pipe while the
+  //others are being read
+  for (const int32_t fd : pipes) {
+    FILE *input = fdopen(fd, "r");
+    char line[512];
+    while (nullptr != fgets(line, sizeof (line), input)) {
+      cfg.partialRecords.emplace_back(line);
+    }
+    fclose(input);
+  }
+
+  bool workersSucceeded = (processesCount == workers.size());
+  for (const pid_t pid : workers) {
+    int32_t status = 0;
+    workersSucceeded = (pid == waitpid(pid, &status, 0)) && WIFEXITED(status)
+        && (EXIT_SUCCESS == WEXITSTATUS(status)) && workersSucceeded;
+  }
+
+  if (!workersSucceeded) {
+    fprintf(stderr, "Error, a worker process failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  cfg.isRangeWorker = false;
+  cfg.mergePartials = true;
+  return runApplication(cfg);
+#else
+  (void)cfg;
+  (void)processesCount;
+  fprintf(stderr, "Error, --processes is supported only on Linux\n");
+
+  return EXIT_FAILURE;
+#endif /* __linux__ */
 }
 
 int32_t main(int32_t argc, char *args[]) {
-  if (EXIT_SUCCESS != SDLLoader::init()) {
+  uint32_t processesCount = 0;
+  const auto appCfg = parseInput(argc, args, processesCount);
+
+  if (0 < processesCount) {
+    return runLocalProcesses(appCfg, processesCount);
+  }
+
+  //headless runs never open a window, so SDL is not needed at all
+  if (!appCfg.headless && (EXIT_SUCCESS != SDLLoader::init())) {
     fprintf(stderr, "Error in SDLLoader::init() -> Terminating ...\n");
 
     return EXIT_FAILURE;
   }
 
-  const auto appCfg = parseInput(argc, args);
   if (EXIT_SUCCESS != runApplication(appCfg)) {
     fprintf(stderr, "runApplication() failed\n");
 
     return EXIT_FAILURE;
   }
 
-  //close SDL libraries
-  SDLLoader::deinit();
+  if (!appCfg.headless) {
+    //close SDL libraries
+    SDLLoader::deinit();
+  }
 
   return EXIT_SUCCESS;
 }
-
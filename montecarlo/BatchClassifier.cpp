@@ -0,0 +1,392 @@
+//Corresponding header
+#include "BatchClassifier.h"
+
+//C system headers
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BATMAN_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+//C++ system headers
+#include <type_traits>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "montecarlo/BatmanConstants.h"
+#include "montecarlo/shapes/BatmanShape.hpp"
+#include "montecarlo/shapes/BatmanSegmentShape.hpp"
+#include "montecarlo/shapes/ShapeClassifier.hpp"
+
+namespace {
+//the oval test is combined with the shape test instead of skipping it,
+//so the loop has no data dependent branches. The divisions are replaced
+//with multiplications by the reciprocals, which like the squared
+//comparisons may only change the result within a rounding error of the
+//outline
+template <typename Real>
+void evaluateSegments(const Real *xs, const Real *ys, const size_t count,
+                      const MonteCarloArgs &args,
+                      EvaluationCounters &outCounters) {
+  const double invRadiusX = 1.0 / args.ovalRadius.x;
+  const double invRadiusY = 1.0 / args.ovalRadius.y;
+  const double invScale = 1.0 / args.animationScale;
+
+  uint64_t pointsInOval = 0;
+  uint64_t pointsInBatman = 0;
+
+  for (size_t i = 0; i < count; ++i) {
+    const double posX = static_cast<double>(xs[i]) - args.animationCenter.x;
+    const double posY = static_cast<double>(ys[i]) - args.animationCenter.y;
+    const double deltaX = posX * invRadiusX;
+    const double deltaY = posY * invRadiusY;
+    const bool inOval = ( (deltaX * deltaX) + (deltaY * deltaY) <= 1.0);
+
+    pointsInOval += inOval;
+    pointsInBatman += inOval & BatmanSegmentShape::contains(
+        posX * invScale, posY * invScale);
+  }
+
+  outCounters.totalPoints += count;
+  outCounters.pointsInOval += pointsInOval;
+  outCounters.pointsInBatman += pointsInBatman;
+}
+}
+
+#ifdef BATMAN_AVX2_KERNEL
+namespace {
+#define AVX2_FUNC __attribute__((target("avx2"), always_inline)) inline
+
+//thin wrappers over the AVX2 intrinsics, so the kernel below is written
+//once for 4 double lanes and once for 8 float lanes
+struct Avx2Double {
+  using Real = double;
+  using Vec = __m256d;
+  static constexpr size_t LANES = 4;
+
+  AVX2_FUNC static Vec set(const double value) {
+    return _mm256_set1_pd(value);
+  }
+
+  AVX2_FUNC static Vec load(const Real *values) {
+    return _mm256_loadu_pd(values);
+  }
+
+  AVX2_FUNC static Vec add(const Vec a, const Vec b) {
+    return _mm256_add_pd(a, b);
+  }
+
+  AVX2_FUNC static Vec sub(const Vec a, const Vec b) {
+    return _mm256_sub_pd(a, b);
+  }
+
+  AVX2_FUNC static Vec mul(const Vec a, const Vec b) {
+    return _mm256_mul_pd(a, b);
+  }
+
+  AVX2_FUNC static Vec div(const Vec a, const Vec b) {
+    return _mm256_div_pd(a, b);
+  }
+
+  AVX2_FUNC static Vec sqrt(const Vec value) {
+    return _mm256_sqrt_pd(value);
+  }
+
+  AVX2_FUNC static Vec negate(const Vec value) {
+    return _mm256_xor_pd(value, _mm256_set1_pd(-0.0));
+  }
+
+  AVX2_FUNC static Vec absolute(const Vec value) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), value);
+  }
+
+  AVX2_FUNC static Vec less(const Vec a, const Vec b) {
+    return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+  }
+
+  AVX2_FUNC static Vec lessEqual(const Vec a, const Vec b) {
+    return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+  }
+
+  AVX2_FUNC static Vec greater(const Vec a, const Vec b) {
+    return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+  }
+
+  AVX2_FUNC static Vec greaterEqual(const Vec a, const Vec b) {
+    return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+  }
+
+  //takes the lanes of b where the mask is set
+  AVX2_FUNC static Vec blend(const Vec a, const Vec b, const Vec mask) {
+    return _mm256_blendv_pd(a, b, mask);
+  }
+
+  AVX2_FUNC static Vec bitAnd(const Vec a, const Vec b) {
+    return _mm256_and_pd(a, b);
+  }
+
+  AVX2_FUNC static Vec bitOr(const Vec a, const Vec b) {
+    return _mm256_or_pd(a, b);
+  }
+
+  AVX2_FUNC static uint32_t countSet(const Vec mask) {
+    return __builtin_popcount(_mm256_movemask_pd(mask));
+  }
+};
+
+struct Avx2Float {
+  using Real = float;
+  using Vec = __m256;
+  static constexpr size_t LANES = 8;
+
+  AVX2_FUNC static Vec set(const double value) {
+    return _mm256_set1_ps(static_cast<float>(value));
+  }
+
+  AVX2_FUNC static Vec load(const Real *values) {
+    return _mm256_loadu_ps(values);
+  }
+
+  AVX2_FUNC static Vec add(const Vec a, const Vec b) {
+    return _mm256_add_ps(a, b);
+  }
+
+  AVX2_FUNC static Vec sub(const Vec a, const Vec b) {
+    return _mm256_sub_ps(a, b);
+  }
+
+  AVX2_FUNC static Vec mul(const Vec a, const Vec b) {
+    return _mm256_mul_ps(a, b);
+  }
+
+  AVX2_FUNC static Vec div(const Vec a, const Vec b) {
+    return _mm256_div_ps(a, b);
+  }
+
+  AVX2_FUNC static Vec sqrt(const Vec value) {
+    return _mm256_sqrt_ps(value);
+  }
+
+  AVX2_FUNC static Vec negate(const Vec value) {
+    return _mm256_xor_ps(value, _mm256_set1_ps(-0.0f));
+  }
+
+  AVX2_FUNC static Vec absolute(const Vec value) {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value);
+  }
+
+  AVX2_FUNC static Vec less(const Vec a, const Vec b) {
+    return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+  }
+
+  AVX2_FUNC static Vec lessEqual(const Vec a, const Vec b) {
+    return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+  }
+
+  AVX2_FUNC static Vec greater(const Vec a, const Vec b) {
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+  }
+
+  AVX2_FUNC static Vec greaterEqual(const Vec a, const Vec b) {
+    return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+  }
+
+  //takes the lanes of b where the mask is set
+  AVX2_FUNC static Vec blend(const Vec a, const Vec b, const Vec mask) {
+    return _mm256_blendv_ps(a, b, mask);
+  }
+
+  AVX2_FUNC static Vec bitAnd(const Vec a, const Vec b) {
+    return _mm256_and_ps(a, b);
+  }
+
+  AVX2_FUNC static Vec bitOr(const Vec a, const Vec b) {
+    return _mm256_or_ps(a, b);
+  }
+
+  AVX2_FUNC static uint32_t countSet(const Vec mask) {
+    return __builtin_popcount(_mm256_movemask_ps(mask));
+  }
+};
+
+//NOTE: every formula below repeats the exact operation order of
+//BatmanShape::contains(), so the double lanes round identically
+template <typename V>
+AVX2_FUNC typename V::Vec isInBatmanAvx2(const typename V::Vec posX,
+                                         const typename V::Vec posY) {
+  using namespace BatmanConstants;
+  using Vec = typename V::Vec;
+
+  const Vec one = V::set(1.0);
+
+  /* wings */
+  const Vec wingX = V::mul(V::set(7.0), V::sqrt(
+      V::sub(one, V::div(V::mul(posY, posY), V::set(9.0)))));
+  const Vec leftWing = V::greaterEqual(posX, V::negate(wingX));
+  const Vec rightWing = V::lessEqual(posX, wingX);
+
+  /* shoulders */
+  const Vec shoulderHash = V::sub(V::absolute(posX), one);
+  const Vec shoulderRoot = V::mul(V::set(HASH_2), V::sqrt(
+      V::sub(V::set(4.0), V::mul(shoulderHash, shoulderHash))));
+  const Vec leftShoulderY = V::add(V::negate(V::add(V::set(HASH_1),
+      V::sub(V::set(1.5), V::mul(V::set(0.5), V::negate(posX))))),
+      shoulderRoot);
+  const Vec rightShoulderY = V::add(V::negate(V::add(V::set(HASH_1),
+      V::sub(V::set(1.5), V::mul(V::set(0.5), posX)))), shoulderRoot);
+  const Vec leftShoulder = V::greater(posY, leftShoulderY);
+  const Vec rightShoulder = V::greater(posY, rightShoulderY);
+
+  /* ears and top of head share the same comparison: POS_Y > -tempY */
+  Vec headY = V::sub(V::set(9.0), V::mul(V::set(8.0), posX));
+  headY = V::blend(headY, V::add(V::mul(V::set(3.0), posX), V::set(0.75)),
+      V::lessEqual(posX, V::set(0.75)));
+  headY = V::blend(headY, V::set(2.25), V::lessEqual(posX, V::set(0.5)));
+  headY = V::blend(headY, V::add(V::mul(V::set(-3.0), posX), V::set(0.75)),
+      V::lessEqual(posX, V::set(-0.5)));
+  headY = V::blend(headY, V::add(V::set(9.0), V::mul(V::set(8.0), posX)),
+      V::lessEqual(posX, V::set(-0.75)));
+  const Vec head = V::greater(posY, V::negate(headY));
+
+  /* upper half - the blends go from right to left, so every segment
+   * overrides the ones with a bigger POS_X */
+  Vec upper = rightWing;
+  upper = V::blend(upper, rightShoulder, V::lessEqual(posX, V::set(3.0)));
+  upper = V::blend(upper, head, V::lessEqual(posX, one));
+  upper = V::blend(upper, leftShoulder, V::lessEqual(posX, V::set(-1.0)));
+  upper = V::blend(upper, leftWing, V::lessEqual(posX, V::set(-3.0)));
+
+  /* bottom wing */
+  const Vec bottomHash = V::sub(V::absolute(
+      V::sub(V::absolute(posX), V::set(2.0))), one);
+  const Vec bottomY = V::negate(V::add(
+      V::sub(V::sub(V::absolute(V::div(posX, V::set(2.0))),
+          V::mul(V::mul(V::set(HASH_3), posX), posX)), V::set(3.0)),
+      V::sqrt(V::sub(one, V::mul(bottomHash, bottomHash)))));
+  const Vec bottom = V::less(posY, bottomY);
+
+  /* lower half */
+  Vec lower = rightWing;
+  lower = V::blend(lower, bottom, V::lessEqual(posX, V::set(4.0)));
+  lower = V::blend(lower, leftWing, V::lessEqual(posX, V::set(-4.0)));
+
+  const Vec upperHalf = V::less(posY, V::set(0.0));
+  const Vec lowerHalf = V::greaterEqual(posY, V::set(0.0));
+
+  return V::bitOr(V::bitAnd(upperHalf, upper), V::bitAnd(lowerHalf, lower));
+}
+
+template <typename V>
+__attribute__((target("avx2")))
+void evaluateAvx2(const typename V::Real *xs, const typename V::Real *ys,
+                  const size_t count, const MonteCarloArgs &args,
+                  EvaluationCounters &outCounters) {
+  using Vec = typename V::Vec;
+
+  const Vec originX = V::set(args.animationCenter.x);
+  const Vec originY = V::set(args.animationCenter.y);
+  const Vec radiusX = V::set(args.ovalRadius.x);
+  const Vec radiusY = V::set(args.ovalRadius.y);
+  const Vec scale = V::set(args.animationScale);
+  const Vec one = V::set(1.0);
+
+  uint64_t pointsInOval = 0;
+  uint64_t pointsInBatman = 0;
+
+  size_t idx = 0;
+  for (; idx + V::LANES <= count; idx += V::LANES) {
+    const Vec relX = V::sub(V::load(xs + idx), originX);
+    const Vec relY = V::sub(V::load(ys + idx), originY);
+
+    const Vec deltaX = V::div(relX, radiusX);
+    const Vec deltaY = V::div(relY, radiusY);
+    const Vec inOval = V::lessEqual(V::add(V::mul(deltaX, deltaX),
+        V::mul(deltaY, deltaY)), one);
+
+    const Vec inBatman = V::bitAnd(inOval, isInBatmanAvx2<V>(
+        V::div(relX, scale), V::div(relY, scale)));
+
+    pointsInOval += V::countSet(inOval);
+    pointsInBatman += V::countSet(inBatman);
+  }
+
+  outCounters.pointsInOval += pointsInOval;
+  outCounters.pointsInBatman += pointsInBatman;
+  outCounters.totalPoints += idx;
+
+  //the remaining points do not fill a whole register
+  ShapeClassifier<BatmanShape>::evaluate(xs + idx, ys + idx, count - idx,
+      args, outCounters);
+}
+
+#undef AVX2_FUNC
+}
+#endif /* BATMAN_AVX2_KERNEL */
+
+namespace {
+template <typename Real>
+void evaluateKernel(const Real *xs, const Real *ys, const size_t count,
+                    const MonteCarloArgs &args, const uint8_t kernel,
+                    EvaluationCounters &outCounters) {
+  if (ClassifierKernel::SEGMENTS == kernel) {
+    evaluateSegments(xs, ys, count, args, outCounters);
+    return;
+  }
+
+#ifdef BATMAN_AVX2_KERNEL
+  if (ClassifierKernel::SIMD == kernel) {
+    using Avx2Lanes = typename std::conditional<std::is_same<Real,
+        float>::value, Avx2Float, Avx2Double>::type;
+    evaluateAvx2<Avx2Lanes>(xs, ys, count, args, outCounters);
+    return;
+  }
+#endif /* BATMAN_AVX2_KERNEL */
+
+  ShapeClassifier<BatmanShape>::evaluate(xs, ys, count, args, outCounters);
+}
+}
+
+void BatchClassifier::evaluate(const double *xs, const double *ys,
+                               const size_t count,
+                               const MonteCarloArgs &args,
+                               const uint8_t kernel,
+                               EvaluationCounters &outCounters) {
+  evaluateKernel(xs, ys, count, args, kernel, outCounters);
+}
+
+void BatchClassifier::evaluate(const float *xs, const float *ys,
+                               const size_t count,
+                               const MonteCarloArgs &args,
+                               const uint8_t kernel,
+                               EvaluationCounters &outCounters) {
+  evaluateKernel(xs, ys, count, args, kernel, outCounters);
+}
+
+uint8_t BatchClassifier::resolveKernel(const uint8_t kernel) {
+  if (ClassifierKernel::SEGMENTS == kernel) {
+    return ClassifierKernel::SEGMENTS;
+  }
+
+#ifdef BATMAN_AVX2_KERNEL
+  if ( (ClassifierKernel::SIMD == kernel) && __builtin_cpu_supports("avx2")) {
+    return ClassifierKernel::SIMD;
+  }
+#endif /* BATMAN_AVX2_KERNEL */
+
+  return ClassifierKernel::SCALAR;
+}
+
+const char* BatchClassifier::getKernelName(const uint8_t kernel) {
+  if (ClassifierKernel::SEGMENTS == kernel) {
+    return "segments";
+  }
+
+  if (ClassifierKernel::SIMD == kernel) {
+#ifdef BATMAN_AVX2_KERNEL
+    return "avx2";
+#endif /* BATMAN_AVX2_KERNEL */
+  }
+
+  return "scalar";
+}
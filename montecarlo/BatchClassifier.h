@@ -0,0 +1,61 @@
+#ifndef MONTECARLO_BATCHCLASSIFIER_H_
+#define MONTECARLO_BATCHCLASSIFIER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+
+class BatchClassifier {
+public:
+  ~BatchClassifier() = delete;
+
+  /** @brief classifies a continuous range of points stored as separate
+   *         x[] and y[] arrays and accumulates the result into the
+   *         provided counters. The SIMD kernel evaluates all branches of
+   *         the Batman equations and selects the results with masked
+   *         blends. It produces bit-identical counts to the scalar one.
+   *         The SEGMENTS kernel is BatmanSegmentShape - branchless and
+   *         without square roots, equal up to rounding on the outline
+   *
+   *  @param const double *         - x coordinates of the points
+   *  @param const double *         - y coordinates of the points
+   *  @param const size_t           - number of points in the range
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param const uint8_t          - requested ClassifierKernel
+   *  @param EvaluationCounters &   - counters to be accumulated
+   * */
+  static void evaluate(const double *xs, const double *ys,
+                       const size_t count, const MonteCarloArgs &args,
+                       const uint8_t kernel, EvaluationCounters &outCounters);
+
+  /** @brief same as above for points stored in single precision. The
+   *         SIMD kernel classifies 8 points at once in single precision.
+   *         The scalar kernels classify in double precision
+   * */
+  static void evaluate(const float *xs, const float *ys,
+                       const size_t count, const MonteCarloArgs &args,
+                       const uint8_t kernel, EvaluationCounters &outCounters);
+
+  /** @brief used to resolve the kernel which will actually be executed.
+   *         The SIMD kernel falls back to the scalar one when the CPU
+   *         does not support it. The SEGMENTS kernel is always available
+   *
+   *  @param const uint8_t - requested ClassifierKernel
+   *
+   *  @returns uint8_t     - used ClassifierKernel
+   * */
+  static uint8_t resolveKernel(const uint8_t kernel);
+
+  static const char* getKernelName(const uint8_t kernel);
+};
+
+#endif /* MONTECARLO_BATCHCLASSIFIER_H_ */
@@ -0,0 +1,27 @@
+//Corresponding header
+#include "BatmanClassifier.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/shapes/BatmanShape.hpp"
+
+bool BatmanClassifier::inOval(const Point &point, const Point &origin,
+                              const Point &ovalRadius) {
+  const double posX = point.x - origin.x;
+  const double posY = point.y - origin.y;
+  const double deltaX = posX / ovalRadius.x;
+  const double deltaY = posY / ovalRadius.y;
+
+  return ( (deltaX * deltaX) + (deltaY * deltaY) <= 1.0) ? true : false;
+}
+
+bool BatmanClassifier::isInBatman(const Point &point, const Point &origin,
+                                  const double scale) {
+  return BatmanShape::contains((point.x - origin.x) / scale,
+      (point.y - origin.y) / scale);
+}
@@ -0,0 +1,42 @@
+#ifndef MONTECARLO_BATMANCLASSIFIER_H_
+#define MONTECARLO_BATMANCLASSIFIER_H_
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+
+class BatmanClassifier {
+public:
+  ~BatmanClassifier() = delete;
+
+  /** @brief checks whether a point lies inside the bounding oval
+   *
+   *  @param const Point & - point to be checked
+   *  @param const Point & - center of the oval
+   *  @param const Point & - radius of the oval on both axis
+   *
+   *  @returns bool        - is the point inside the oval
+   * */
+  static bool inOval(const Point &point, const Point &origin,
+                     const Point &ovalRadius);
+
+  /** @brief checks whether a point lies inside the Batman shape
+   *
+   *  @param const Point & - point to be checked
+   *  @param const Point & - center of the Batman shape
+   *  @param const double  - scale of the Batman shape
+   *
+   *  @returns bool        - is the point inside the Batman shape
+   * */
+  static bool isInBatman(const Point &point, const Point &origin,
+                         const double scale);
+};
+
+#endif /* MONTECARLO_BATMANCLASSIFIER_H_ */
@@ -0,0 +1,23 @@
+#ifndef MONTECARLO_BATMANCONSTANTS_H_
+#define MONTECARLO_BATMANCONSTANTS_H_
+
+//C system headers
+
+//C++ system headers
+#include <cmath>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+//coefficients of the Batman curve equations. Shared by all classifier
+//kernels, so they produce bit-identical results
+namespace BatmanConstants {
+const double HASH_1 = (6 * sqrt(10)) / 7;
+const double HASH_2 = HASH_1 / 2;
+const double HASH_3 = ( (3 * sqrt(33)) - 7) / 112;
+}
+
+#endif /* MONTECARLO_BATMANCONSTANTS_H_ */
@@ -0,0 +1,86 @@
+//Corresponding header
+#include "DensityGrid.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+
+namespace {
+//counts below this use a precomputed intensity instead of a logarithm
+constexpr uint32_t INTENSITY_LUT_SIZE = 1 << 16;
+
+constexpr uint32_t ALPHA_OPAQUE = 0xFF;
+}
+
+int32_t DensityGrid::init(const int32_t gridWidth,
+                          const int32_t gridHeight) {
+  if ((0 >= gridWidth) || (0 >= gridHeight)) {
+    return EXIT_FAILURE;
+  }
+
+  _width = gridWidth;
+  _height = gridHeight;
+
+  const size_t cellsCount = static_cast<size_t>(_width) * _height;
+  _insideHits.reset(new std::atomic<uint32_t>[cellsCount]);
+  _outsideHits.reset(new std::atomic<uint32_t>[cellsCount]);
+  for (size_t i = 0; i < cellsCount; ++i) {
+    _insideHits[i].store(0, std::memory_order_relaxed);
+    _outsideHits[i].store(0, std::memory_order_relaxed);
+  }
+
+  _intensityLut.resize(INTENSITY_LUT_SIZE);
+
+  return EXIT_SUCCESS;
+}
+
+void DensityGrid::toRGBA(uint32_t *outPixels) {
+  const size_t cellsCount = static_cast<size_t>(_width) * _height;
+
+  uint32_t maxCount = 0;
+  for (size_t i = 0; i < cellsCount; ++i) {
+    maxCount = std::max(maxCount,
+        _insideHits[i].load(std::memory_order_relaxed));
+    maxCount = std::max(maxCount,
+        _outsideHits[i].load(std::memory_order_relaxed));
+  }
+
+  const double logMaxCount = std::log1p(static_cast<double>(maxCount));
+  const uint32_t lutSize = std::min(maxCount + 1, INTENSITY_LUT_SIZE);
+  for (uint32_t count = 0; count < lutSize; ++count) {
+    _intensityLut[count] = static_cast<uint8_t>(
+        (0.0 < logMaxCount) ?
+            (255.0 * std::log1p(static_cast<double>(count))) / logMaxCount :
+            0.0);
+  }
+
+  //the counters may have grown since the maximum was found - clamp them,
+  //so only the up to date part of the table is used
+  for (size_t i = 0; i < cellsCount; ++i) {
+    const uint32_t inside = getIntensity(std::min(maxCount,
+        _insideHits[i].load(std::memory_order_relaxed)), logMaxCount);
+    const uint32_t outside = getIntensity(std::min(maxCount,
+        _outsideHits[i].load(std::memory_order_relaxed)), logMaxCount);
+
+    //red and green for the outside hits, blue for the inside ones
+    outPixels[i] = (outside << 24) | (outside << 16) | (inside << 8)
+        | ALPHA_OPAQUE;
+  }
+}
+
+uint8_t DensityGrid::getIntensity(const uint32_t count,
+                                  const double logMaxCount) {
+  if (INTENSITY_LUT_SIZE > count) {
+    return _intensityLut[count];
+  }
+
+  return static_cast<uint8_t>(
+      (255.0 * std::log1p(static_cast<double>(count))) / logMaxCount);
+}
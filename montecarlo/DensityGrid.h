@@ -0,0 +1,81 @@
+#ifndef MONTECARLO_DENSITYGRID_H_
+#define MONTECARLO_DENSITYGRID_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief per-pixel counters of the samples inside and outside of the
+ *         target. Any number of threads may add samples concurrently while
+ *         another thread converts the counters to colors, so the sampling
+ *         density can be visualized without storing any points
+ * */
+class DensityGrid {
+public:
+  /** @brief allocates zeroed counters. Not thread safe
+   *
+   *  @param const int32_t - grid width in pixels
+   *  @param const int32_t - grid height in pixels
+   *
+   *  @returns int32_t     - error code
+   * */
+  int32_t init(const int32_t gridWidth, const int32_t gridHeight);
+
+  /** @brief counts a sample. Samples outside of the grid are ignored.
+   *         Thread safe
+   *
+   *  @param const double - x coordinate in pixels
+   *  @param const double - y coordinate in pixels
+   *  @param const bool   - whether the sample is inside of the target
+   * */
+  inline void addSample(const double x, const double y, const bool inside) {
+    if ((0.0 > x) || (0.0 > y)) {
+      return;
+    }
+
+    const int32_t pixelX = static_cast<int32_t>(x);
+    const int32_t pixelY = static_cast<int32_t>(y);
+    if ((pixelX >= _width) || (pixelY >= _height)) {
+      return;
+    }
+
+    std::atomic<uint32_t> *counters = inside ? _insideHits.get()
+                                             : _outsideHits.get();
+    counters[static_cast<size_t>(pixelY) * _width + pixelX].fetch_add(1,
+        std::memory_order_relaxed);
+  }
+
+  /** @brief converts the counters to RGBA8888 pixels. Samples outside of
+   *         the target are shown in yellow, inside of the target in blue.
+   *         The brightness is logarithmic in the count, normalized to the
+   *         busiest pixel. May run concurrently with addSample()
+   *
+   *  @param uint32_t * - width * height output pixels
+   * */
+  void toRGBA(uint32_t *outPixels);
+
+private:
+  //brightness in [0, 255] of a count relative to the maximum count
+  uint8_t getIntensity(const uint32_t count, const double logMaxCount);
+
+  std::unique_ptr<std::atomic<uint32_t>[]> _insideHits;
+  std::unique_ptr<std::atomic<uint32_t>[]> _outsideHits;
+
+  //intensity of the small counts, rebuilt on every toRGBA() call
+  std::vector<uint8_t> _intensityLut;
+
+  int32_t _width = 0;
+  int32_t _height = 0;
+};
+
+#endif /* MONTECARLO_DENSITYGRID_H_ */
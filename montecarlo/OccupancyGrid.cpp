@@ -0,0 +1,283 @@
+//Corresponding header
+#include "OccupancyGrid.h"
+
+//C system headers
+#ifdef __linux__
+#include <unistd.h>
+#endif /* __linux__ */
+
+//C++ system headers
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "montecarlo/ProbeLattice.h"
+#include "montecarlo/shapes/ShapeFactory.h"
+
+namespace {
+//the probes of a fine cell are dilated by its neighbours below, so a
+//coarse lattice is enough
+constexpr uint32_t PROBE_STEPS = 2;
+
+//mixed points gathered before they are evaluated with the exact kernel
+constexpr size_t MIXED_BLOCK_SIZE = 256;
+
+constexpr char CACHE_MAGIC[8] = { 'B', 'A', 'T', 'O', 'C', 'C', '\0', '\0' };
+
+//increase when the layout of the grid or the probing changes
+constexpr uint32_t CACHE_VERSION = 1;
+}
+
+//identifies the shape and the geometry a cache file was built for.
+//Zero filled, so it can be compared with memcmp
+struct OccupancyGrid::CacheHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t fineWidth;
+  uint32_t fineHeight;
+  uint32_t probeSteps;
+  double originX;
+  double originY;
+  double invCellWidth;
+  double invCellHeight;
+  char shapeName[32];
+};
+
+int32_t OccupancyGrid::init(const ShapeKernels &shape,
+                            const MonteCarloArgs &args,
+                            const char *cachePath) {
+  _shape = &shape;
+  _originX = args.animationCenter.x - args.ovalRadius.x;
+  _originY = args.animationCenter.y - args.ovalRadius.y;
+  _invCellWidth = FINE_WIDTH / (2.0 * args.ovalRadius.x);
+  _invCellHeight = FINE_HEIGHT / (2.0 * args.ovalRadius.y);
+
+  _fineRegions.assign( (FINE_WIDTH * FINE_HEIGHT) / 4, 0);
+  //the extra tile is the sentinel of the points outside of the grid
+  _coarseRegions.assign(COARSE_WIDTH * COARSE_HEIGHT + 1,
+      PointRegion::OUT_OF_BOUNDS);
+
+  _loadedFromCache = (nullptr != cachePath) && load(cachePath);
+  if (_loadedFromCache) {
+    return EXIT_SUCCESS;
+  }
+
+  build(shape, args);
+
+  if ((nullptr != cachePath) && (EXIT_SUCCESS != save(cachePath))) {
+    fprintf(stderr, "Warning, the occupancy grid could not be cached in "
+        "%s\n", cachePath);
+  }
+
+  return EXIT_SUCCESS;
+}
+
+void OccupancyGrid::evaluate(const double *xs, const double *ys,
+                             const size_t count, const MonteCarloArgs &args,
+                             const uint8_t kernel,
+                             EvaluationCounters &outCounters) const {
+  alignas(32) double mixedXs[MIXED_BLOCK_SIZE];
+  alignas(32) double mixedYs[MIXED_BLOCK_SIZE];
+  size_t mixedCount = 0;
+
+  //points per PointRegion resolved by the lookup. The last slot counts
+  //the mixed points, which are evaluated separately
+  uint64_t regionCounts[MIXED_REGION + 1] = { 0, 0, 0, 0 };
+
+  for (size_t i = 0; i < count; ++i) {
+    //the truncation towards zero maps points up to one cell left of or
+    //above the grid to its first row/column, which is either outside of
+    //the oval or mixed, so the result is still exact
+    const uint32_t fineX = static_cast<uint32_t>(
+        static_cast<int32_t>((xs[i] - _originX) * _invCellWidth));
+    const uint32_t fineY = static_cast<uint32_t>(
+        static_cast<int32_t>((ys[i] - _originY) * _invCellHeight));
+    const bool isInGrid = (FINE_WIDTH > fineX) && (FINE_HEIGHT > fineY);
+
+    //points outside of the grid read the OUT_OF_BOUNDS sentinel tile
+    const uint32_t tileIdx = isInGrid ? (fineY >> COARSE_SHIFT)
+        * COARSE_WIDTH + (fineX >> COARSE_SHIFT) : COARSE_WIDTH
+        * COARSE_HEIGHT;
+    uint8_t region = _coarseRegions[tileIdx];
+    if (MIXED_REGION == region) {
+      region = getFineRegion(fineX, fineY);
+    }
+    ++regionCounts[region];
+
+    //unconditional store, kept only for the mixed points
+    mixedXs[mixedCount] = xs[i];
+    mixedYs[mixedCount] = ys[i];
+    mixedCount += (MIXED_REGION == region);
+    if (MIXED_BLOCK_SIZE == mixedCount) {
+      _shape->evaluate(mixedXs, mixedYs, mixedCount, args, kernel,
+          outCounters);
+      mixedCount = 0;
+    }
+  }
+
+  if (0 < mixedCount) {
+    _shape->evaluate(mixedXs, mixedYs, mixedCount, args, kernel,
+        outCounters);
+  }
+
+  const uint64_t inOval = regionCounts[PointRegion::OUTSIDE_SHAPE]
+      + regionCounts[PointRegion::INSIDE_SHAPE];
+  outCounters.totalPoints += regionCounts[PointRegion::OUT_OF_BOUNDS]
+      + inOval;
+  outCounters.pointsInOval += inOval;
+  outCounters.pointsInBatman += regionCounts[PointRegion::INSIDE_SHAPE];
+}
+
+double OccupancyGrid::getMixedCellsRatio() const {
+  uint32_t mixedCells = 0;
+  for (uint32_t cellY = 0; cellY < FINE_HEIGHT; ++cellY) {
+    for (uint32_t cellX = 0; cellX < FINE_WIDTH; ++cellX) {
+      mixedCells += (MIXED_REGION == getFineRegion(cellX, cellY));
+    }
+  }
+
+  return static_cast<double>(mixedCells) / (FINE_WIDTH * FINE_HEIGHT);
+}
+
+void OccupancyGrid::build(const ShapeKernels &shape,
+                          const MonteCarloArgs &args) {
+  CellGrid grid;
+  grid.originX = _originX;
+  grid.originY = _originY;
+  grid.cellWidth = 1.0 / _invCellWidth;
+  grid.cellHeight = 1.0 / _invCellHeight;
+  grid.width = FINE_WIDTH;
+  grid.height = FINE_HEIGHT;
+
+  //region of every cell from its own probes
+  std::vector<uint8_t> cellRegions;
+  ProbeLattice::probeCells(shape, args, grid, PROBE_STEPS, cellRegions);
+  for (uint8_t &region : cellRegions) {
+    region = ProbeLattice::getUniformRegion(region);
+  }
+
+  //a cell stays uniform only if all its neighbours have the same region
+  for (uint32_t cellY = 0; cellY < FINE_HEIGHT; ++cellY) {
+    for (uint32_t cellX = 0; cellX < FINE_WIDTH; ++cellX) {
+      const uint32_t cellIdx = cellY * FINE_WIDTH + cellX;
+      uint8_t region = cellRegions[cellIdx];
+
+      const uint32_t firstY = (0 < cellY) ? cellY - 1 : cellY;
+      const uint32_t lastY = (FINE_HEIGHT - 1 > cellY) ? cellY + 1 : cellY;
+      const uint32_t firstX = (0 < cellX) ? cellX - 1 : cellX;
+      const uint32_t lastX = (FINE_WIDTH - 1 > cellX) ? cellX + 1 : cellX;
+      for (uint32_t y = firstY; y <= lastY; ++y) {
+        for (uint32_t x = firstX; x <= lastX; ++x) {
+          if (region != cellRegions[y * FINE_WIDTH + x]) {
+            region = MIXED_REGION;
+          }
+        }
+      }
+
+      setFineRegion(cellIdx, region);
+    }
+  }
+
+  buildCoarseLevel();
+}
+
+void OccupancyGrid::buildCoarseLevel() {
+  for (uint32_t tileY = 0; tileY < COARSE_HEIGHT; ++tileY) {
+    for (uint32_t tileX = 0; tileX < COARSE_WIDTH; ++tileX) {
+      const uint32_t firstX = tileX * COARSE_TILE;
+      const uint32_t firstY = tileY * COARSE_TILE;
+
+      uint8_t region = getFineRegion(firstX, firstY);
+      for (uint32_t y = firstY; y < firstY + COARSE_TILE; ++y) {
+        for (uint32_t x = firstX; x < firstX + COARSE_TILE; ++x) {
+          if (region != getFineRegion(x, y)) {
+            region = MIXED_REGION;
+          }
+        }
+      }
+
+      _coarseRegions[tileY * COARSE_WIDTH + tileX] = region;
+    }
+  }
+}
+
+bool OccupancyGrid::load(const char *cachePath) {
+  FILE *file = fopen(cachePath, "rb");
+  if (nullptr == file) {
+    return false;
+  }
+
+  CacheHeader expected;
+  fillCacheHeader(expected);
+
+  CacheHeader header;
+  const bool isValid = (1 == fread(&header, sizeof (header), 1, file))
+      && (0 == memcmp(&header, &expected, sizeof (header)))
+      && (_fineRegions.size() == fread(_fineRegions.data(), 1,
+          _fineRegions.size(), file));
+  fclose(file);
+
+  if (!isValid) {
+    fprintf(stderr, "Warning, %s is not an occupancy grid of the current "
+        "shape. Rebuilding it\n", cachePath);
+
+    return false;
+  }
+
+  //the coarse level is cheap, so it is not stored
+  buildCoarseLevel();
+
+  return true;
+}
+
+void OccupancyGrid::fillCacheHeader(CacheHeader &outHeader) const {
+  memset(&outHeader, 0, sizeof (outHeader));
+  memcpy(outHeader.magic, CACHE_MAGIC, sizeof (CACHE_MAGIC));
+  outHeader.version = CACHE_VERSION;
+  outHeader.fineWidth = FINE_WIDTH;
+  outHeader.fineHeight = FINE_HEIGHT;
+  outHeader.probeSteps = PROBE_STEPS;
+  outHeader.originX = _originX;
+  outHeader.originY = _originY;
+  outHeader.invCellWidth = _invCellWidth;
+  outHeader.invCellHeight = _invCellHeight;
+  strncpy(outHeader.shapeName, _shape->name,
+      sizeof (outHeader.shapeName) - 1);
+}
+
+int32_t OccupancyGrid::save(const char *cachePath) const {
+  //the workers of --processes may build the grid at the same time, so
+  //every process writes its own file and renames it over the cache
+#ifdef __linux__
+  const std::string tmpPath = std::string(cachePath) + ".tmp."
+      + std::to_string(getpid());
+#else
+  const std::string tmpPath = std::string(cachePath) + ".tmp";
+#endif /* __linux__ */
+
+  FILE *file = fopen(tmpPath.c_str(), "wb");
+  if (nullptr == file) {
+    return EXIT_FAILURE;
+  }
+
+  CacheHeader header;
+  fillCacheHeader(header);
+
+  const bool isWritten = (1 == fwrite(&header, sizeof (header), 1, file))
+      && (_fineRegions.size() == fwrite(_fineRegions.data(), 1,
+          _fineRegions.size(), file));
+
+  if ( (0 != fclose(file)) || !isWritten
+      || (0 != rename(tmpPath.c_str(), cachePath))) {
+    remove(tmpPath.c_str());
+
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
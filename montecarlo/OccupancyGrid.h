@@ -0,0 +1,144 @@
+#ifndef MONTECARLO_OCCUPANCYGRID_H_
+#define MONTECARLO_OCCUPANCYGRID_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+#include "montecarlo/ProbeLattice.h"
+
+//Forward declarations
+struct ShapeKernels;
+
+/** @brief two level lookup table of the PointRegion over the bounding box
+ *         of the oval, so most points are classified without evaluating
+ *         the shape.
+ *
+ *         The fine level stores 2 bits per cell - one of the PointRegion
+ *         values or MIXED_REGION for cells which the boundary of the oval
+ *         or of the shape may cross. The coarse level stores one byte per
+ *         tile of COARSE_TILE x COARSE_TILE fine cells and answers the
+ *         uniform tiles from a table which fits in L1. Only the points in
+ *         mixed cells are evaluated with the exact kernel of the shape.
+ *
+ *         A fine cell is uniform when all probes of the ProbeLattice
+ *         over it agree and so do the probes of its 8 neighbours, which
+ *         covers the rounding of the cell lookup and keeps a margin around
+ *         the detected boundary.
+ * */
+class OccupancyGrid {
+public:
+  /** @brief loads the grid from the cache file or builds it from the
+   *         shape. A newly built grid is stored in the cache file
+   *
+   *  @param const ShapeKernels &   - kernels of the shape
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param const char *           - path of the cache file.
+   *                                  nullptr disables the cache
+   *
+   *  @returns int32_t              - error code
+   * */
+  int32_t init(const ShapeKernels &shape, const MonteCarloArgs &args,
+               const char *cachePath);
+
+  /** @brief classifies a range of points and accumulates the counters.
+   *         Produces the same counters as ShapeKernels::evaluate
+   *
+   *  @param const double *         - x coordinates
+   *  @param const double *         - y coordinates
+   *  @param const size_t           - points count
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param const uint8_t          - ClassifierKernel of the mixed cells
+   *  @param EvaluationCounters &   - accumulated counters
+   * */
+  void evaluate(const double *xs, const double *ys, const size_t count,
+                const MonteCarloArgs &args, const uint8_t kernel,
+                EvaluationCounters &outCounters) const;
+
+  //share of the fine cells which fall back to the exact kernel
+  double getMixedCellsRatio() const;
+
+  inline bool isLoadedFromCache() const {
+    return _loadedFromCache;
+  }
+
+private:
+  enum InternalDefines : uint32_t {
+    FINE_WIDTH = 1024,
+    FINE_HEIGHT = 512,
+
+    //fine cells per coarse tile side. Must be a power of two
+    COARSE_SHIFT = 5,
+    COARSE_TILE = 1 << COARSE_SHIFT,
+    COARSE_WIDTH = FINE_WIDTH / COARSE_TILE,
+    COARSE_HEIGHT = FINE_HEIGHT / COARSE_TILE,
+
+    //outside of the PointRegion values
+    MIXED_REGION = ProbeLattice::MIXED_REGION
+  };
+
+  struct CacheHeader;
+
+  //probes the shape and fills both levels
+  void build(const ShapeKernels &shape, const MonteCarloArgs &args);
+
+  void buildCoarseLevel();
+
+  /** @brief reads both levels from the cache file
+   *
+   *  @returns bool - false if the file is missing or was built for a
+   *                  different shape or grid
+   * */
+  bool load(const char *cachePath);
+
+  /** @brief stores the fine level in the cache file. The file is written
+   *         under a temporary name and renamed, so readers only ever see
+   *         a complete grid
+   *
+   *  @returns int32_t - error code
+   * */
+  int32_t save(const char *cachePath) const;
+
+  void fillCacheHeader(CacheHeader &outHeader) const;
+
+  inline uint8_t getFineRegion(const uint32_t cellX,
+                               const uint32_t cellY) const {
+    const uint32_t cellIdx = cellY * FINE_WIDTH + cellX;
+    return (_fineRegions[cellIdx >> 2] >> ( (cellIdx & 3) * 2)) & 3;
+  }
+
+  inline void setFineRegion(const uint32_t cellIdx, const uint8_t region) {
+    const uint32_t shift = (cellIdx & 3) * 2;
+    uint8_t &packed = _fineRegions[cellIdx >> 2];
+    packed = static_cast<uint8_t>((packed & ~(3 << shift))
+        | (region << shift));
+  }
+
+  //2 bits per fine cell, 4 cells per byte in row-major order
+  std::vector<uint8_t> _fineRegions;
+
+  //one region per coarse tile, followed by the OUT_OF_BOUNDS sentinel
+  std::vector<uint8_t> _coarseRegions;
+
+  //kernels of the shape used for the mixed cells
+  const ShapeKernels *_shape = nullptr;
+
+  //top left corner of the grid in pixels
+  double _originX = 0.0;
+  double _originY = 0.0;
+
+  //fine cells per pixel
+  double _invCellWidth = 0.0;
+  double _invCellHeight = 0.0;
+
+  bool _loadedFromCache = false;
+};
+
+#endif /* MONTECARLO_OCCUPANCYGRID_H_ */
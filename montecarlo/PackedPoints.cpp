@@ -0,0 +1,80 @@
+//Corresponding header
+#include "PackedPoints.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+
+namespace {
+constexpr double FIXED_POINT_STEPS = 65536.0;
+
+uint16_t toFixedPoint(const double value, const double invStep) {
+  const double step = std::min(std::max(value * invStep, 0.0),
+      FIXED_POINT_STEPS - 1.0);
+
+  return static_cast<uint16_t>(step);
+}
+}
+
+int32_t PackedPoints::init(const uint32_t windowWidth,
+                           const uint32_t windowHeight,
+                           const uint8_t placement) {
+  if ((0 == windowWidth) || (0 == windowHeight)) {
+    return EXIT_FAILURE;
+  }
+
+  _xs = Coordinates(SampleAllocator<uint16_t>(placement));
+  _ys = Coordinates(SampleAllocator<uint16_t>(placement));
+
+  _stepX = windowWidth / FIXED_POINT_STEPS;
+  _stepY = windowHeight / FIXED_POINT_STEPS;
+  _invStepX = FIXED_POINT_STEPS / windowWidth;
+  _invStepY = FIXED_POINT_STEPS / windowHeight;
+
+  return EXIT_SUCCESS;
+}
+
+void PackedPoints::resize(const size_t count) {
+  _xs.resize(count);
+  _ys.resize(count);
+}
+
+void PackedPoints::pack(const size_t firstIdx, const size_t count,
+                        const double *xs, const double *ys) {
+  uint16_t *outXs = _xs.data() + firstIdx;
+  uint16_t *outYs = _ys.data() + firstIdx;
+
+  for (size_t i = 0; i < count; ++i) {
+    outXs[i] = toFixedPoint(xs[i], _invStepX);
+    outYs[i] = toFixedPoint(ys[i], _invStepY);
+  }
+}
+
+void PackedPoints::unpack(const size_t firstIdx, const size_t count,
+                          double *outXs, double *outYs) const {
+  unpackRange(firstIdx, count, outXs, outYs);
+}
+
+void PackedPoints::unpack(const size_t firstIdx, const size_t count,
+                          float *outXs, float *outYs) const {
+  unpackRange(firstIdx, count, outXs, outYs);
+}
+
+template <typename Real>
+void PackedPoints::unpackRange(const size_t firstIdx, const size_t count,
+                               Real *outXs, Real *outYs) const {
+  const uint16_t *xs = _xs.data() + firstIdx;
+  const uint16_t *ys = _ys.data() + firstIdx;
+
+  //the middle of the step keeps the restored points uniformly distributed
+  for (size_t i = 0; i < count; ++i) {
+    outXs[i] = static_cast<Real>((xs[i] + 0.5) * _stepX);
+    outYs[i] = static_cast<Real>((ys[i] + 0.5) * _stepY);
+  }
+}
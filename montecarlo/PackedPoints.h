@@ -0,0 +1,89 @@
+#ifndef MONTECARLO_PACKEDPOINTS_H_
+#define MONTECARLO_PACKEDPOINTS_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/SampleAllocator.hpp"
+
+//Forward declarations
+
+/** @brief sample storage with 16 bit fixed point coordinates - 4 bytes per
+ *         point instead of the 16 bytes of PointsSoA.
+ *
+ *         Every axis of the window is split into 65536 equal steps. A
+ *         coordinate is stored as the index of its step and restored to
+ *         the middle of the step, so it moves by at most half a step
+ *         (0.015 pixels for a 1920 pixels wide window). Only the points
+ *         within that distance of the outline may be classified
+ *         differently than their full precision originals
+ * */
+class PackedPoints {
+public:
+  /** @brief used to set up the fixed point scale
+   *
+   *  @param const uint32_t - window width
+   *  @param const uint32_t - window height
+   *  @param const uint8_t  - MemoryPlacement of the storage
+   *
+   *  @returns int32_t      - error code
+   * */
+  int32_t init(const uint32_t windowWidth, const uint32_t windowHeight,
+               const uint8_t placement);
+
+  void resize(const size_t count);
+
+  inline size_t size() const {
+    return _xs.size();
+  }
+
+  /** @brief stores a block of points. Coordinates outside of the window
+   *         are clamped to its border
+   *
+   *  @param const size_t   - index of the first stored point
+   *  @param const size_t   - number of points
+   *  @param const double * - x coordinates in pixels
+   *  @param const double * - y coordinates in pixels
+   * */
+  void pack(const size_t firstIdx, const size_t count, const double *xs,
+            const double *ys);
+
+  /** @brief restores a block of points
+   *
+   *  @param const size_t - index of the first restored point
+   *  @param const size_t - number of points
+   *  @param double *     - output x coordinates in pixels
+   *  @param double *     - output y coordinates in pixels
+   * */
+  void unpack(const size_t firstIdx, const size_t count, double *outXs,
+              double *outYs) const;
+
+  //same as above in single precision
+  void unpack(const size_t firstIdx, const size_t count, float *outXs,
+              float *outYs) const;
+
+private:
+  template <typename Real>
+  void unpackRange(const size_t firstIdx, const size_t count, Real *outXs,
+                   Real *outYs) const;
+
+  using Coordinates = std::vector<uint16_t, SampleAllocator<uint16_t>>;
+
+  Coordinates _xs;
+  Coordinates _ys;
+
+  //pixels per fixed point step and the inverse
+  double _stepX = 0.0;
+  double _stepY = 0.0;
+  double _invStepX = 0.0;
+  double _invStepY = 0.0;
+};
+
+#endif /* MONTECARLO_PACKEDPOINTS_H_ */
@@ -0,0 +1,125 @@
+//Corresponding header
+#include "ParallelEvaluator.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+
+namespace {
+//small enough to balance the uneven per-point cost across the workers,
+//big enough to amortize the scheduling and the task dispatch
+constexpr uint64_t CHUNK_SIZE = 1 << 12;
+}
+
+using Time = std::chrono::steady_clock;
+
+int32_t ParallelEvaluator::init(const uint32_t threadsCount,
+                                const uint8_t schedulingPolicy) {
+  _schedulingPolicy = schedulingPolicy;
+
+  uint32_t usedThreads = threadsCount;
+  if (0 == usedThreads) {
+    usedThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  if (EXIT_SUCCESS != _threadPool.init(usedThreads)) {
+    fprintf(stderr, "Error, _threadPool.init() failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  _workerData.resize(_threadPool.getWorkersCount());
+
+  return EXIT_SUCCESS;
+}
+
+void ParallelEvaluator::deinit() {
+  _threadPool.deinit();
+}
+
+EvaluationCounters ParallelEvaluator::evaluate(const uint64_t samplesCount,
+                                               const RangeTask &task) {
+  for (WorkerData &data : _workerData) {
+    data = WorkerData();
+  }
+
+  const uint64_t chunksCount = (samplesCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  _scheduler.reset(_threadPool.getWorkersCount(), chunksCount);
+
+  const Time::time_point start = Time::now();
+  _threadPool.runOnAllWorkers(
+      [this, &task, samplesCount](const uint32_t workerId) {
+        if (SchedulingPolicy::STATIC == _schedulingPolicy) {
+          runStatic(workerId, samplesCount, task);
+        } else {
+          runWorkStealing(workerId, samplesCount, task);
+        }
+      });
+  const std::chrono::duration<double> elapsed = Time::now() - start;
+  _wallSeconds = elapsed.count();
+
+  EvaluationCounters result;
+  for (const WorkerData &data : _workerData) {
+    result.merge(data.counters);
+  }
+
+  return result;
+}
+
+void ParallelEvaluator::printWorkerStats() const {
+  const double wallSeconds = (0.0 < _wallSeconds) ? _wallSeconds : 1e-9;
+
+  for (size_t i = 0; i < _workerData.size(); ++i) {
+    const WorkerStats &stats = _workerData[i].stats;
+    printf("Worker %zu: %llu chunks (%llu stolen), utilization %.1f%%\n", i,
+        static_cast<unsigned long long>(stats.chunksProcessed),
+        static_cast<unsigned long long>(stats.chunksStolen),
+        (stats.busySeconds / wallSeconds) * 100.0);
+  }
+}
+
+void ParallelEvaluator::runStatic(const uint32_t workerId,
+                                  const uint64_t samplesCount,
+                                  const RangeTask &task) {
+  WorkerData &data = _workerData[workerId];
+  const uint64_t workersCount = _workerData.size();
+  const uint64_t chunksCount = (samplesCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+  //every worker owns a continuous block of chunks
+  const uint64_t firstChunk = (chunksCount * workerId) / workersCount;
+  const uint64_t lastChunk = (chunksCount * (workerId + 1)) / workersCount;
+
+  const Time::time_point start = Time::now();
+  for (uint64_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+    const uint64_t firstIdx = chunk * CHUNK_SIZE;
+    task(workerId, firstIdx, std::min(CHUNK_SIZE, samplesCount - firstIdx),
+        data.counters);
+  }
+  const std::chrono::duration<double> elapsed = Time::now() - start;
+
+  data.stats.busySeconds = elapsed.count();
+  data.stats.chunksProcessed = lastChunk - firstChunk;
+}
+
+void ParallelEvaluator::runWorkStealing(const uint32_t workerId,
+                                        const uint64_t samplesCount,
+                                        const RangeTask &task) {
+  WorkerData &data = _workerData[workerId];
+
+  _scheduler.runWorker(workerId,
+      [&task, &data, samplesCount](const uint32_t id, const uint64_t chunkIdx) {
+        const uint64_t firstIdx = chunkIdx * CHUNK_SIZE;
+        task(id, firstIdx, std::min(CHUNK_SIZE, samplesCount - firstIdx),
+            data.counters);
+      }, data.stats);
+}
@@ -0,0 +1,90 @@
+#ifndef MONTECARLO_PARALLELEVALUATOR_H_
+#define MONTECARLO_PARALLELEVALUATOR_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <vector>
+#include <functional>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+#include "montecarlo/ThreadPool.h"
+#include "montecarlo/WorkStealingScheduler.h"
+
+//Forward declarations
+
+class ParallelEvaluator {
+public:
+  /** @brief evaluates the samples in range [firstIdx, firstIdx + count)
+   *         and accumulates the result into the provided counters.
+   *         Invoked concurrently from different workers for
+   *         non-overlapping ranges. The worker index can be used to
+   *         access per-worker state without synchronization
+   * */
+  using RangeTask = std::function<void(const uint32_t workerId,
+      const uint64_t firstIdx, const uint64_t count,
+      EvaluationCounters &outCounters)>;
+
+  /** @brief used to spawn the worker threads
+   *
+   *  @param const uint32_t - threads count. 0 means one per hardware thread
+   *  @param const uint8_t  - SchedulingPolicy of the chunks
+   *
+   *  @returns int32_t      - error code
+   * */
+  int32_t init(const uint32_t threadsCount, const uint8_t schedulingPolicy);
+
+  void deinit();
+
+  /** @brief splits [0, samplesCount) into small fixed size chunks and
+   *         evaluates them across all workers. Every worker accumulates
+   *         into its own counters. The counters are integers, so the
+   *         reduced result is identical for any threads count and for
+   *         any chunk distribution
+   *
+   *  @param const uint64_t    - total samples count
+   *  @param const RangeTask & - task evaluating a single chunk
+   *
+   *  @returns EvaluationCounters - the reduced counters
+   * */
+  EvaluationCounters evaluate(const uint64_t samplesCount,
+                              const RangeTask &task);
+
+  /** @brief prints the per-worker statistics of the last evaluate() call
+   * */
+  void printWorkerStats() const;
+
+  inline uint32_t getThreadsCount() const {
+    return _threadPool.getWorkersCount();
+  }
+
+private:
+  //padded to a cache line so workers do not false share their counters
+  struct alignas(64) WorkerData {
+    EvaluationCounters counters;
+    WorkerStats stats;
+  };
+
+  void runStatic(const uint32_t workerId, const uint64_t samplesCount,
+                 const RangeTask &task);
+
+  void runWorkStealing(const uint32_t workerId, const uint64_t samplesCount,
+                       const RangeTask &task);
+
+  ThreadPool _threadPool;
+
+  WorkStealingScheduler _scheduler;
+
+  std::vector<WorkerData> _workerData;
+
+  //duration of the last evaluate() call
+  double _wallSeconds = 0.0;
+
+  uint8_t _schedulingPolicy = 0;
+};
+
+#endif /* MONTECARLO_PARALLELEVALUATOR_H_ */
@@ -0,0 +1,147 @@
+//Corresponding header
+#include "PartialCounts.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+
+namespace {
+//the widths must match the sizes of the PartialCounts names
+constexpr const char *RECORD_FORMAT = "{\"shape\":\"%31[^\"]\","
+    "\"sampler\":\"%31[^\"]\",\"domain\":\"%15[^\"]\","
+    "\"precision\":\"%15[^\"]\",\"seed\":%llu,\"first\":%llu,"
+    "\"count\":%llu,\"points\":%llu,\"inOval\":%llu,\"inShape\":%llu}";
+
+constexpr int32_t RECORD_FIELDS_COUNT = 10;
+
+bool isSameSetup(const PartialCounts &left, const PartialCounts &right) {
+  return (0 == strcmp(left.shapeName, right.shapeName))
+      && (0 == strcmp(left.samplerName, right.samplerName))
+      && (0 == strcmp(left.domainName, right.domainName))
+      && (0 == strcmp(left.precisionName, right.precisionName))
+      && (left.seed == right.seed);
+}
+}
+
+void PartialCountsRecord::write(const PartialCounts &partial, FILE *file) {
+  fprintf(file, "{\"shape\":\"%s\",\"sampler\":\"%s\",\"domain\":\"%s\","
+      "\"precision\":\"%s\",\"seed\":%llu,\"first\":%llu,\"count\":%llu,"
+      "\"points\":%llu,\"inOval\":%llu,\"inShape\":%llu}\n",
+      partial.shapeName, partial.samplerName, partial.domainName,
+      partial.precisionName, static_cast<unsigned long long>(partial.seed),
+      static_cast<unsigned long long>(partial.firstIdx),
+      static_cast<unsigned long long>(partial.count),
+      static_cast<unsigned long long>(partial.counters.totalPoints),
+      static_cast<unsigned long long>(partial.counters.pointsInOval),
+      static_cast<unsigned long long>(partial.counters.pointsInBatman));
+}
+
+int32_t PartialCountsRecord::parse(const char *line,
+                                   PartialCounts &outPartial) {
+  unsigned long long values[6] = { 0, 0, 0, 0, 0, 0 };
+  const int32_t fieldsCount = sscanf(line, RECORD_FORMAT,
+      outPartial.shapeName, outPartial.samplerName, outPartial.domainName,
+      outPartial.precisionName, &values[0], &values[1], &values[2],
+      &values[3], &values[4], &values[5]);
+  if (RECORD_FIELDS_COUNT != fieldsCount) {
+    return EXIT_FAILURE;
+  }
+
+  outPartial.seed = values[0];
+  outPartial.firstIdx = values[1];
+  outPartial.count = values[2];
+  outPartial.counters.totalPoints = values[3];
+  outPartial.counters.pointsInOval = values[4];
+  outPartial.counters.pointsInBatman = values[5];
+
+  return EXIT_SUCCESS;
+}
+
+int32_t PartialCountsMerger::add(const PartialCounts &partial) {
+  if (!_partials.empty() && !isSameSetup(_partials.front(), partial)) {
+    fprintf(stderr, "Error, the range [%llu, +%llu) was evaluated for %s, "
+        "%s, %s, %s, seed %llu, but the first one for %s, %s, %s, %s, "
+        "seed %llu\n", static_cast<unsigned long long>(partial.firstIdx),
+        static_cast<unsigned long long>(partial.count), partial.shapeName,
+        partial.samplerName, partial.domainName, partial.precisionName,
+        static_cast<unsigned long long>(partial.seed),
+        _partials.front().shapeName, _partials.front().samplerName,
+        _partials.front().domainName, _partials.front().precisionName,
+        static_cast<unsigned long long>(_partials.front().seed));
+
+    return EXIT_FAILURE;
+  }
+
+  if (partial.counters.totalPoints != partial.count) {
+    fprintf(stderr, "Error, the range [%llu, +%llu) reports %llu evaluated "
+        "points\n", static_cast<unsigned long long>(partial.firstIdx),
+        static_cast<unsigned long long>(partial.count),
+        static_cast<unsigned long long>(partial.counters.totalPoints));
+
+    return EXIT_FAILURE;
+  }
+
+  _partials.push_back(partial);
+
+  return EXIT_SUCCESS;
+}
+
+int32_t PartialCountsMerger::merge(PartialCounts &outTotal) const {
+  if (_partials.empty()) {
+    fprintf(stderr, "Error, no partial counts to merge\n");
+
+    return EXIT_FAILURE;
+  }
+
+  std::vector<const PartialCounts*> sorted;
+  sorted.reserve(_partials.size());
+  for (const PartialCounts &partial : _partials) {
+    sorted.push_back(&partial);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+      [](const PartialCounts *left, const PartialCounts *right) {
+        return left->firstIdx < right->firstIdx;
+      });
+
+  outTotal = *sorted.front();
+  outTotal.count = 0;
+  outTotal.counters = EvaluationCounters();
+
+  uint64_t gapsCount = 0;
+  uint64_t nextIdx = sorted.front()->firstIdx;
+  for (const PartialCounts *partial : sorted) {
+    if (partial->firstIdx < nextIdx) {
+      fprintf(stderr, "Error, the range [%llu, +%llu) overlaps the "
+          "previous one, which ends at %llu\n",
+          static_cast<unsigned long long>(partial->firstIdx),
+          static_cast<unsigned long long>(partial->count),
+          static_cast<unsigned long long>(nextIdx));
+
+      return EXIT_FAILURE;
+    }
+
+    gapsCount += (partial->firstIdx > nextIdx);
+    nextIdx = partial->firstIdx + partial->count;
+
+    outTotal.count += partial->count;
+    outTotal.counters.merge(partial->counters);
+  }
+
+  //the estimate of a subset of the samples is still unbiased, only its
+  //confidence interval is wider than planned
+  if (0 < gapsCount) {
+    fprintf(stderr, "Warning, the merged ranges leave %llu gaps in "
+        "[%llu, %llu)\n", static_cast<unsigned long long>(gapsCount),
+        static_cast<unsigned long long>(outTotal.firstIdx),
+        static_cast<unsigned long long>(nextIdx));
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#ifndef MONTECARLO_PARTIALCOUNTS_H_
+#define MONTECARLO_PARTIALCOUNTS_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+
+/** @brief counters of the sample range [firstIdx, firstIdx + count)
+ *         evaluated by one process, together with everything which must
+ *         match for the ranges to be combined into one estimate
+ * */
+struct PartialCounts {
+  char shapeName[32] = { };
+  char samplerName[32] = { };
+  char domainName[16] = { };
+  char precisionName[16] = { };
+  uint64_t seed = 0;
+
+  uint64_t firstIdx = 0;
+  uint64_t count = 0;
+
+  EvaluationCounters counters;
+};
+
+/** @brief exchanges PartialCounts as single line JSON records, e.g.
+ *         {"shape":"batman","sampler":"philox4x32-10","domain":"window",
+ *         "precision":"double","seed":7,"first":0,"count":1000,
+ *         "points":1000,"inOval":698,"inShape":336}
+ *
+ *         The keys are always written in this order and only this exact
+ *         layout is parsed back
+ * */
+class PartialCountsRecord {
+public:
+  PartialCountsRecord() = delete;
+  ~PartialCountsRecord() = delete;
+
+  //writes the record followed by a new line
+  static void write(const PartialCounts &partial, FILE *file);
+
+  /** @brief parses a record written by write()
+   *
+   *  @param const char *     - the line of the record
+   *  @param PartialCounts &  - the parsed record
+   *
+   *  @returns int32_t        - error code
+   * */
+  static int32_t parse(const char *line, PartialCounts &outPartial);
+};
+
+/** @brief combines the PartialCounts of disjoint sample ranges. The
+ *         counters are integers, so the result is identical to evaluating
+ *         all ranges in a single process
+ * */
+class PartialCountsMerger {
+public:
+  /** @brief adds a partial result. Fails if it was produced for another
+   *         shape, sampler, domain, precision or seed than the first one
+   *
+   *  @returns int32_t - error code
+   * */
+  int32_t add(const PartialCounts &partial);
+
+  /** @brief sums the added partial results. Fails if any two ranges
+   *         overlap, warns if they leave gaps
+   *
+   *  @param PartialCounts & - the combined result. Its range starts at
+   *                           the first evaluated sample and its count is
+   *                           the number of evaluated samples
+   *
+   *  @returns int32_t       - error code
+   * */
+  int32_t merge(PartialCounts &outTotal) const;
+
+  inline size_t getPartialsCount() const {
+    return _partials.size();
+  }
+
+private:
+  std::vector<PartialCounts> _partials;
+};
+
+#endif /* MONTECARLO_PARTIALCOUNTS_H_ */
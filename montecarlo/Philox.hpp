@@ -0,0 +1,69 @@
+#ifndef MONTECARLO_PHILOX_HPP_
+#define MONTECARLO_PHILOX_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief Philox4x32-10 counter-based random number generator
+ *         (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3").
+ *         The output is a pure function of (key, counter), so any sample
+ *         can be generated independently without any shared state
+ * */
+class Philox4x32 {
+public:
+  struct Block {
+    uint32_t v[4];
+  };
+
+  explicit Philox4x32(const uint64_t seed)
+      : _key0(static_cast<uint32_t>(seed)),
+        _key1(static_cast<uint32_t>(seed >> 32)) {
+
+  }
+
+  inline Block generate(const uint64_t counter) const {
+    Block block { { static_cast<uint32_t>(counter),
+        static_cast<uint32_t>(counter >> 32), 0, 0 } };
+    uint32_t key0 = _key0;
+    uint32_t key1 = _key1;
+
+    for (int32_t round = 0; round < ROUNDS_COUNT; ++round) {
+      if (0 != round) {
+        key0 += WEYL_0;
+        key1 += WEYL_1;
+      }
+
+      const uint64_t product0 = static_cast<uint64_t>(MULTIPLIER_0) *
+          block.v[0];
+      const uint64_t product1 = static_cast<uint64_t>(MULTIPLIER_1) *
+          block.v[2];
+
+      block = Block { { static_cast<uint32_t>(product1 >> 32) ^ block.v[1]
+          ^ key0, static_cast<uint32_t>(product1),
+          static_cast<uint32_t>(product0 >> 32) ^ block.v[3] ^ key1,
+          static_cast<uint32_t>(product0) } };
+    }
+
+    return block;
+  }
+
+private:
+  static constexpr int32_t ROUNDS_COUNT = 10;
+  static constexpr uint32_t MULTIPLIER_0 = 0xD2511F53;
+  static constexpr uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+  static constexpr uint32_t WEYL_0 = 0x9E3779B9;
+  static constexpr uint32_t WEYL_1 = 0xBB67AE85;
+
+  uint32_t _key0;
+  uint32_t _key1;
+};
+
+#endif /* MONTECARLO_PHILOX_HPP_ */
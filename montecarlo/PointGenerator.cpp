@@ -0,0 +1,86 @@
+//Corresponding header
+#include "PointGenerator.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/SamplerFactory.h"
+
+namespace {
+//double precision points generated at once by the float overload.
+//The x and y blocks together occupy 16 KB, so they stay in L1
+constexpr size_t CONVERSION_BLOCK_SIZE = 1024;
+}
+
+int32_t PointGenerator::init(const uint8_t samplerType,
+                             const uint32_t workersCount,
+                             const uint32_t windowWidth,
+                             const uint32_t windowHeight,
+                             const uint64_t seed) {
+  _windowWidth = windowWidth;
+  _windowHeight = windowHeight;
+
+  _sampler = SamplerFactory::create(samplerType, workersCount, seed);
+  if (nullptr == _sampler) {
+    fprintf(stderr, "Error, unknown sampler type: %hhu\n", samplerType);
+
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+void PointGenerator::setEllipseDomain(const Point &center,
+                                      const Point &radius) {
+  _ellipseCenter = center;
+  _ellipseRadius = radius;
+  _domain = SamplingDomain::ELLIPSE;
+}
+
+void PointGenerator::generate(const uint32_t workerId,
+                              const uint64_t firstIdx, const size_t count,
+                              double *outXs, double *outYs) {
+  _sampler->generate(workerId, firstIdx, count, outXs, outYs);
+
+  if (SamplingDomain::ELLIPSE == _domain) {
+    for (size_t i = 0; i < count; ++i) {
+      const double radius = sqrt(outXs[i]);
+      const double angle = (2.0 * M_PI) * outYs[i];
+      outXs[i] = _ellipseCenter.x + (_ellipseRadius.x * radius) * cos(angle);
+      outYs[i] = _ellipseCenter.y + (_ellipseRadius.y * radius) * sin(angle);
+    }
+
+    return;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    outXs[i] *= _windowWidth;
+    outYs[i] *= _windowHeight;
+  }
+}
+
+void PointGenerator::generate(const uint32_t workerId,
+                              const uint64_t firstIdx, const size_t count,
+                              float *outXs, float *outYs) {
+  double xs[CONVERSION_BLOCK_SIZE];
+  double ys[CONVERSION_BLOCK_SIZE];
+
+  for (size_t offset = 0; offset < count; offset += CONVERSION_BLOCK_SIZE) {
+    const size_t blockSize =
+        std::min(CONVERSION_BLOCK_SIZE, count - offset);
+    generate(workerId, firstIdx + offset, blockSize, xs, ys);
+
+    for (size_t i = 0; i < blockSize; ++i) {
+      outXs[offset + i] = static_cast<float>(xs[i]);
+      outYs[offset + i] = static_cast<float>(ys[i]);
+    }
+  }
+}
@@ -0,0 +1,110 @@
+#ifndef MONTECARLO_POINTGENERATOR_H_
+#define MONTECARLO_POINTGENERATOR_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "common/CommonStructs.hpp"
+#include "montecarlo/samplers/Sampler.h"
+
+//Forward declarations
+
+/** @brief generates points inside the window (or inside an ellipse)
+ *         from the unit square samples of the selected Sampler
+ * */
+class PointGenerator {
+public:
+  /** @brief used to create and seed the sampler
+   *
+   *  @param const uint8_t  - SamplerType to be used
+   *  @param const uint32_t - workers count
+   *  @param const uint32_t - window width
+   *  @param const uint32_t - window height
+   *  @param const uint64_t - seed of the sampler
+   *
+   *  @returns int32_t      - error code
+   * */
+  int32_t init(const uint8_t samplerType, const uint32_t workersCount,
+               const uint32_t windowWidth, const uint32_t windowHeight,
+               const uint64_t seed);
+
+  /** @brief generates all following points uniformly inside an ellipse
+   *         instead of the whole window, so no samples are spent outside
+   *         of the bounding region. The unit square is mapped with
+   *         r = sqrt(u), theta = 2 * pi * v, which preserves the area, so
+   *         the stratification of the low-discrepancy samplers is kept
+   *
+   *  @param const Point & - center of the ellipse
+   *  @param const Point & - radius of the ellipse on both axis
+   * */
+  void setEllipseDomain(const Point &center, const Point &radius);
+
+  /** @brief generates a block of points
+   *
+   *  @param const uint32_t - index of the calling worker
+   *  @param const uint64_t - global index of the first generated sample
+   *  @param const size_t   - number of points to be generated
+   *  @param double *       - output x coordinates
+   *  @param double *       - output y coordinates
+   * */
+  void generate(const uint32_t workerId, const uint64_t firstIdx,
+                const size_t count, double *outXs, double *outYs);
+
+  /** @brief generates a block of points in single precision. The points
+   *         are generated in double precision block by block and rounded,
+   *         so they are the same points as the ones of the double overload
+   * */
+  void generate(const uint32_t workerId, const uint64_t firstIdx,
+                const size_t count, float *outXs, float *outYs);
+
+  /** @brief generates a block of raw samples in the unit square [0, 1)^2,
+   *         ignoring the window size and the sampling domain
+   *
+   *  @param const uint32_t - index of the calling worker
+   *  @param const uint64_t - global index of the first generated sample
+   *  @param const size_t   - number of samples to be generated
+   *  @param double *       - output x coordinates
+   *  @param double *       - output y coordinates
+   * */
+  inline void generateUnitSquare(const uint32_t workerId,
+                                 const uint64_t firstIdx, const size_t count,
+                                 double *outXs, double *outYs) {
+    _sampler->generate(workerId, firstIdx, count, outXs, outYs);
+  }
+
+  /** @brief whether generate() depends only on the sample indices, so
+   *         sub-ranges can be generated independently and in any order
+   * */
+  inline bool isIndexAddressable() const {
+    return _sampler->isIndexAddressable();
+  }
+
+  inline const char* getSamplerName() const {
+    return _sampler->getName();
+  }
+
+  inline const char* getDomainName() const {
+    return (SamplingDomain::ELLIPSE == _domain) ? "ellipse" : "window";
+  }
+
+private:
+  std::unique_ptr<Sampler> _sampler;
+
+  double _windowWidth = 0.0;
+  double _windowHeight = 0.0;
+
+  Point _ellipseCenter;
+  Point _ellipseRadius;
+
+  uint8_t _domain = SamplingDomain::WINDOW;
+};
+
+#endif /* MONTECARLO_POINTGENERATOR_H_ */
@@ -0,0 +1,60 @@
+//Corresponding header
+#include "ProbeLattice.h"
+
+//C system headers
+
+//C++ system headers
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/shapes/ShapeFactory.h"
+
+uint64_t ProbeLattice::probeCells(const ShapeKernels &shape,
+                                  const MonteCarloArgs &args,
+                                  const CellGrid &grid,
+                                  const uint32_t probeSteps,
+                                  std::vector<uint8_t> &outRegionMasks) {
+  const size_t latticeWidth = static_cast<size_t>(grid.width) * probeSteps
+      + 1;
+  const size_t latticeHeight = static_cast<size_t>(grid.height) * probeSteps
+      + 1;
+  const double stepX = grid.cellWidth / probeSteps;
+  const double stepY = grid.cellHeight / probeSteps;
+
+  std::vector<uint8_t> lattice(latticeWidth * latticeHeight);
+  std::vector<double> xs(latticeWidth);
+  std::vector<double> ys(latticeWidth);
+  for (size_t i = 0; i < latticeWidth; ++i) {
+    xs[i] = grid.originX + i * stepX;
+  }
+
+  for (size_t row = 0; row < latticeHeight; ++row) {
+    std::fill(ys.begin(), ys.end(), grid.originY + row * stepY);
+    shape.classify(xs.data(), ys.data(), latticeWidth, args,
+        lattice.data() + row * latticeWidth);
+  }
+
+  outRegionMasks.assign(static_cast<size_t>(grid.width) * grid.height, 0);
+  for (uint32_t cellY = 0; cellY < grid.height; ++cellY) {
+    for (uint32_t cellX = 0; cellX < grid.width; ++cellX) {
+      uint8_t regionMask = 0;
+      for (uint32_t probeY = 0; probeY <= probeSteps; ++probeY) {
+        const uint8_t *probes = lattice.data()
+            + (static_cast<size_t>(cellY) * probeSteps + probeY)
+                * latticeWidth
+            + static_cast<size_t>(cellX) * probeSteps;
+        for (uint32_t probeX = 0; probeX <= probeSteps; ++probeX) {
+          regionMask = static_cast<uint8_t>(regionMask
+              | (1 << probes[probeX]));
+        }
+      }
+
+      outRegionMasks[static_cast<size_t>(cellY) * grid.width + cellX] =
+          regionMask;
+    }
+  }
+
+  return latticeWidth * latticeHeight;
+}
@@ -0,0 +1,76 @@
+#ifndef MONTECARLO_PROBELATTICE_H_
+#define MONTECARLO_PROBELATTICE_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+struct ShapeKernels;
+
+//grid of equal cells over a rectangle in pixels
+struct CellGrid {
+  //top left corner of the grid
+  double originX = 0.0;
+  double originY = 0.0;
+
+  double cellWidth = 0.0;
+  double cellHeight = 0.0;
+
+  uint32_t width = 0;
+  uint32_t height = 0;
+};
+
+/** @brief finds which PointRegion values occur in every cell of a grid.
+ *
+ *         Every cell is checked on a (probeSteps + 1) x (probeSteps + 1)
+ *         lattice of probes including its corners and edges, so
+ *         neighbouring cells share their edge probes. Features thinner
+ *         than the probe spacing which do not cross any probe are missed,
+ *         so the lattice must be fine compared to the details of the shape
+ * */
+class ProbeLattice {
+public:
+  ~ProbeLattice() = delete;
+
+  //returned for cells whose probes do not all agree
+  static constexpr uint8_t MIXED_REGION = 3;
+
+  /** @brief classifies the probes of every cell
+   *
+   *  @param const ShapeKernels &   - kernels of the shape
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param const CellGrid &       - the probed grid
+   *  @param const uint32_t         - probe intervals per cell side
+   *  @param std::vector<uint8_t> & - bit mask (1 << PointRegion) of the
+   *                                  regions found in every cell, in
+   *                                  row-major order
+   *
+   *  @returns uint64_t             - number of shape evaluations
+   * */
+  static uint64_t probeCells(const ShapeKernels &shape,
+                             const MonteCarloArgs &args,
+                             const CellGrid &grid, const uint32_t probeSteps,
+                             std::vector<uint8_t> &outRegionMasks);
+
+  //the PointRegion of a cell whose probes all agree, MIXED_REGION otherwise
+  static inline uint8_t getUniformRegion(const uint8_t regionMask) {
+    for (uint8_t region = 0; region < MIXED_REGION; ++region) {
+      if ((1 << region) == regionMask) {
+        return region;
+      }
+    }
+
+    return MIXED_REGION;
+  }
+};
+
+#endif /* MONTECARLO_PROBELATTICE_H_ */
@@ -0,0 +1,57 @@
+//Corresponding header
+#include "RunningStats.h"
+
+//C system headers
+
+//C++ system headers
+#include <cmath>
+
+//Other libraries headers
+
+//Own components headers
+
+void RunningStats::addBernoulliBatch(const uint64_t count,
+                                     const uint64_t hits) {
+  if (0 == count) {
+    return;
+  }
+
+  RunningStats batch;
+  batch._count = count;
+  batch._mean = static_cast<double>(hits) / static_cast<double>(count);
+  //sum((x - mean)^2) over the batch, where x is either 0 or 1
+  batch._m2 = static_cast<double>(hits) * (1.0 - batch._mean);
+
+  merge(batch);
+}
+
+void RunningStats::merge(const RunningStats &other) {
+  if (0 == other._count) {
+    return;
+  }
+
+  const double count = static_cast<double>(_count);
+  const double otherCount = static_cast<double>(other._count);
+  const double totalCount = count + otherCount;
+  const double delta = other._mean - _mean;
+
+  _mean += delta * (otherCount / totalCount);
+  _m2 += other._m2 + (delta * delta) * ( (count * otherCount) / totalCount);
+  _count += other._count;
+}
+
+double RunningStats::getVariance() const {
+  if (2 > _count) {
+    return 0.0;
+  }
+
+  return _m2 / static_cast<double>(_count - 1);
+}
+
+double RunningStats::getStandardError() const {
+  if (0 == _count) {
+    return 0.0;
+  }
+
+  return sqrt(getVariance() / static_cast<double>(_count));
+}
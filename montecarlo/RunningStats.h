@@ -0,0 +1,53 @@
+#ifndef MONTECARLO_RUNNINGSTATS_H_
+#define MONTECARLO_RUNNINGSTATS_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief numerically stable online mean and variance (Welford).
+ *         Partial statistics are combined with the parallel form of the
+ *         update (Chan et al.), so whole batches of samples can be added
+ *         at once with the same result as adding them one by one
+ * */
+class RunningStats {
+public:
+  /** @brief adds a batch of 0/1 samples
+   *
+   *  @param const uint64_t - number of samples in the batch
+   *  @param const uint64_t - number of samples equal to 1
+   * */
+  void addBernoulliBatch(const uint64_t count, const uint64_t hits);
+
+  void merge(const RunningStats &other);
+
+  inline uint64_t getCount() const {
+    return _count;
+  }
+
+  inline double getMean() const {
+    return _mean;
+  }
+
+  //unbiased sample variance
+  double getVariance() const;
+
+  //standard error of the mean
+  double getStandardError() const;
+
+private:
+  uint64_t _count = 0;
+  double _mean = 0.0;
+
+  //sum of squared differences from the mean
+  double _m2 = 0.0;
+};
+
+#endif /* MONTECARLO_RUNNINGSTATS_H_ */
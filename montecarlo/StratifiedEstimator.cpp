@@ -0,0 +1,238 @@
+//Corresponding header
+#include "StratifiedEstimator.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "montecarlo/PointGenerator.h"
+#include "montecarlo/ParallelEvaluator.h"
+#include "montecarlo/ProbeLattice.h"
+#include "montecarlo/shapes/ShapeFactory.h"
+
+namespace {
+//probe intervals per cell side. The cells are much bigger than the ones
+//of the OccupancyGrid and are not dilated, so they are probed densely
+constexpr uint32_t PROBE_STEPS = 4;
+
+//samples per boundary cell used to estimate its hit ratio before the
+//rest of the budget is allocated
+constexpr uint64_t PILOT_SAMPLES = 64;
+
+//samples generated and classified at once
+constexpr size_t SAMPLE_BLOCK_SIZE = 1024;
+
+//hit ratio with add-half smoothing, so cells whose samples all agreed
+//still get samples and still contribute to the variance
+double smoothedRatio(const uint64_t hits, const uint64_t samples) {
+  return (hits + 0.5) / (samples + 1.0);
+}
+}
+
+int32_t StratifiedEstimator::init(const uint32_t gridWidth,
+                                  const uint32_t gridHeight) {
+  if ((0 == gridWidth) || (0 == gridHeight)) {
+    return EXIT_FAILURE;
+  }
+
+  _gridWidth = gridWidth;
+  _gridHeight = gridHeight;
+  _cellTypes.resize(static_cast<size_t>(_gridWidth) * _gridHeight);
+
+  return EXIT_SUCCESS;
+}
+
+StratifiedResult StratifiedEstimator::estimate(
+    const ShapeKernels &shape, const MonteCarloArgs &args,
+    PointGenerator &generator, ParallelEvaluator &evaluator,
+    const uint64_t evaluationsBudget) {
+  _originX = args.animationCenter.x - args.ovalRadius.x;
+  _originY = args.animationCenter.y - args.ovalRadius.y;
+  _cellWidth = (2.0 * args.ovalRadius.x) / _gridWidth;
+  _cellHeight = (2.0 * args.ovalRadius.y) / _gridHeight;
+
+  StratifiedResult result;
+  result.probeEvaluations = probeCells(shape, args);
+  result.boundaryCells = static_cast<uint32_t>(_boundaryCells.size());
+  for (const uint8_t cellType : _cellTypes) {
+    if (INSIDE_CELL == cellType) {
+      ++result.insideCells;
+    } else if (OUTSIDE_CELL == cellType) {
+      ++result.outsideCells;
+    }
+  }
+
+  const double SCALE_AREA = args.animationScale * args.animationScale;
+  const double CELL_AREA = (_cellWidth * _cellHeight) / SCALE_AREA;
+  result.area = result.insideCells * CELL_AREA;
+
+  const size_t boundaryCount = _boundaryCells.size();
+  if (0 == boundaryCount) {
+    return result;
+  }
+
+  _cellSamples.assign(boundaryCount, 0);
+  _cellHits.assign(boundaryCount, 0);
+  _workerHits.resize(evaluator.getThreadsCount());
+
+  //the pilot pass gets at least one sample per cell even if the budget
+  //is already spent on the probes, otherwise the cells can not be
+  //estimated at all
+  const uint64_t remainingBudget =
+      (evaluationsBudget > result.probeEvaluations) ?
+          evaluationsBudget - result.probeEvaluations : 0;
+  const uint64_t pilotSamples = std::max<uint64_t>(1,
+      std::min(PILOT_SAMPLES, remainingBudget / boundaryCount));
+
+  std::vector<uint64_t> passSamples(boundaryCount, pilotSamples);
+  result.sampleEvaluations += sampleBoundaryCells(shape, args, generator,
+      evaluator, passSamples, 0);
+
+  //Neyman allocation - equal cell areas, so the optimal share of a cell
+  //is proportional to the standard deviation of its hit indicator
+  const uint64_t pilotTotal = pilotSamples * boundaryCount;
+  const uint64_t mainBudget =
+      (remainingBudget > pilotTotal) ? remainingBudget - pilotTotal : 0;
+
+  std::vector<double> deviations(boundaryCount);
+  double deviationsSum = 0.0;
+  for (size_t i = 0; i < boundaryCount; ++i) {
+    const double ratio = smoothedRatio(_cellHits[i], _cellSamples[i]);
+    deviations[i] = sqrt(ratio * (1.0 - ratio));
+    deviationsSum += deviations[i];
+  }
+
+  for (size_t i = 0; i < boundaryCount; ++i) {
+    passSamples[i] = static_cast<uint64_t>(
+        (mainBudget * deviations[i]) / deviationsSum);
+  }
+  result.sampleEvaluations += sampleBoundaryCells(shape, args, generator,
+      evaluator, passSamples, result.sampleEvaluations);
+
+  double variance = 0.0;
+  for (size_t i = 0; i < boundaryCount; ++i) {
+    const double samples = static_cast<double>(_cellSamples[i]);
+    result.area += (CELL_AREA * _cellHits[i]) / samples;
+
+    const double ratio = smoothedRatio(_cellHits[i], _cellSamples[i]);
+    variance += (CELL_AREA * CELL_AREA * ratio * (1.0 - ratio)) / samples;
+  }
+  result.standardError = sqrt(variance);
+
+  return result;
+}
+
+uint64_t StratifiedEstimator::probeCells(const ShapeKernels &shape,
+                                         const MonteCarloArgs &args) {
+  CellGrid grid;
+  grid.originX = _originX;
+  grid.originY = _originY;
+  grid.cellWidth = _cellWidth;
+  grid.cellHeight = _cellHeight;
+  grid.width = _gridWidth;
+  grid.height = _gridHeight;
+
+  std::vector<uint8_t> regionMasks;
+  const uint64_t evaluations = ProbeLattice::probeCells(shape, args, grid,
+      PROBE_STEPS, regionMasks);
+
+  //both the points outside of the oval and outside of the shape miss it
+  constexpr uint8_t INSIDE_MASK = 1 << PointRegion::INSIDE_SHAPE;
+
+  _boundaryCells.clear();
+  for (uint32_t cellIdx = 0; cellIdx < regionMasks.size(); ++cellIdx) {
+    if (0 == (INSIDE_MASK & regionMasks[cellIdx])) {
+      _cellTypes[cellIdx] = OUTSIDE_CELL;
+    } else if (INSIDE_MASK == regionMasks[cellIdx]) {
+      _cellTypes[cellIdx] = INSIDE_CELL;
+    } else {
+      _cellTypes[cellIdx] = BOUNDARY_CELL;
+      _boundaryCells.push_back(cellIdx);
+    }
+  }
+
+  return evaluations;
+}
+
+uint64_t StratifiedEstimator::sampleBoundaryCells(
+    const ShapeKernels &shape, const MonteCarloArgs &args,
+    PointGenerator &generator, ParallelEvaluator &evaluator,
+    const std::vector<uint64_t> &samplesPerCell,
+    const uint64_t firstSampleIdx) {
+  const size_t boundaryCount = _boundaryCells.size();
+
+  //the samples of the pass are numbered continuously, cell after cell,
+  //so the workers split them evenly no matter how they are allocated
+  std::vector<uint64_t> offsets(boundaryCount + 1, 0);
+  for (size_t i = 0; i < boundaryCount; ++i) {
+    offsets[i + 1] = offsets[i] + samplesPerCell[i];
+  }
+
+  for (std::vector<uint64_t> &hits : _workerHits) {
+    hits.assign(boundaryCount, 0);
+  }
+
+  const EvaluationCounters counters = evaluator.evaluate(offsets.back(),
+      [this, &shape, &args, &generator, &offsets, firstSampleIdx](
+          const uint32_t workerId, const uint64_t rangeIdx,
+          const uint64_t rangeCount, EvaluationCounters &outCounters) {
+        alignas(32) double xs[SAMPLE_BLOCK_SIZE];
+        alignas(32) double ys[SAMPLE_BLOCK_SIZE];
+        uint32_t slots[SAMPLE_BLOCK_SIZE];
+        uint8_t regions[SAMPLE_BLOCK_SIZE];
+        uint64_t *hits = _workerHits[workerId].data();
+
+        //last boundary cell whose samples start at or before rangeIdx
+        size_t slot = static_cast<size_t>(std::upper_bound(offsets.begin(),
+            offsets.end(), rangeIdx) - offsets.begin()) - 1;
+
+        for (uint64_t offset = 0; offset < rangeCount;
+            offset += SAMPLE_BLOCK_SIZE) {
+          const size_t blockSize = static_cast<size_t>(
+              std::min<uint64_t>(SAMPLE_BLOCK_SIZE, rangeCount - offset));
+          const uint64_t blockIdx = rangeIdx + offset;
+
+          generator.generateUnitSquare(workerId, firstSampleIdx + blockIdx,
+              blockSize, xs, ys);
+
+          for (size_t i = 0; i < blockSize; ++i) {
+            while (offsets[slot + 1] <= blockIdx + i) {
+              ++slot;
+            }
+
+            const uint32_t cellIdx = _boundaryCells[slot];
+            const uint32_t cellX = cellIdx % _gridWidth;
+            const uint32_t cellY = cellIdx / _gridWidth;
+            xs[i] = _originX + (cellX + xs[i]) * _cellWidth;
+            ys[i] = _originY + (cellY + ys[i]) * _cellHeight;
+            slots[i] = static_cast<uint32_t>(slot);
+          }
+
+          shape.classify(xs, ys, blockSize, args, regions);
+
+          for (size_t i = 0; i < blockSize; ++i) {
+            const bool inside = (PointRegion::INSIDE_SHAPE == regions[i]);
+            hits[slots[i]] += inside;
+            outCounters.pointsInBatman += inside;
+          }
+        }
+
+        outCounters.totalPoints += rangeCount;
+      });
+
+  for (size_t i = 0; i < boundaryCount; ++i) {
+    _cellSamples[i] += samplesPerCell[i];
+    for (const std::vector<uint64_t> &hits : _workerHits) {
+      _cellHits[i] += hits[i];
+    }
+  }
+
+  return counters.totalPoints;
+}
@@ -0,0 +1,136 @@
+#ifndef MONTECARLO_STRATIFIEDESTIMATOR_H_
+#define MONTECARLO_STRATIFIEDESTIMATOR_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+struct ShapeKernels;
+class PointGenerator;
+class ParallelEvaluator;
+
+struct StratifiedResult {
+  //estimated area and its standard error in shape units
+  double area = 0.0;
+  double standardError = 0.0;
+
+  //shape evaluations spent on the probe lattice and on the samples
+  uint64_t probeEvaluations = 0;
+  uint64_t sampleEvaluations = 0;
+
+  uint32_t insideCells = 0;
+  uint32_t outsideCells = 0;
+  uint32_t boundaryCells = 0;
+};
+
+/** @brief stratified estimator of the area of a shape.
+ *
+ *         The bounding box of the oval is split into a grid of cells,
+ *         which are probed with a ProbeLattice. Cells with no probe inside
+ *         of the shape or with all probes inside are taken as fully
+ *         outside or fully inside and contribute their whole (or zero)
+ *         area without any sampling. Only the boundary cells are
+ *         sampled - first with a fixed pilot count, then the rest of the
+ *         budget is split among them proportional to the standard
+ *         deviation of their pilot hit ratio (Neyman allocation), so the
+ *         samples end up where the boundary cuts the cells the most.
+ * */
+class StratifiedEstimator {
+public:
+  /** @brief used to set up the grid over the bounding box of the oval
+   *
+   *  @param const uint32_t - cells on the x axis
+   *  @param const uint32_t - cells on the y axis
+   *
+   *  @returns int32_t      - error code
+   * */
+  int32_t init(const uint32_t gridWidth, const uint32_t gridHeight);
+
+  /** @brief estimates the area of the shape
+   *
+   *  @param const ShapeKernels &   - kernels of the shape
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param PointGenerator &       - source of the unit square samples
+   *  @param ParallelEvaluator &    - workers evaluating the samples
+   *  @param const uint64_t         - total shape evaluations budget,
+   *                                  including the probes
+   *
+   *  @returns StratifiedResult     - the estimate and the statistics
+   * */
+  StratifiedResult estimate(const ShapeKernels &shape,
+                            const MonteCarloArgs &args,
+                            PointGenerator &generator,
+                            ParallelEvaluator &evaluator,
+                            const uint64_t evaluationsBudget);
+
+  inline uint32_t getGridWidth() const {
+    return _gridWidth;
+  }
+
+  inline uint32_t getGridHeight() const {
+    return _gridHeight;
+  }
+
+private:
+  enum CellType : uint8_t {
+    OUTSIDE_CELL,
+    INSIDE_CELL,
+    BOUNDARY_CELL
+  };
+
+  /** @brief classifies the probe lattice and fills _cellTypes and
+   *         _boundaryCells
+   *
+   *  @returns uint64_t - number of shape evaluations
+   * */
+  uint64_t probeCells(const ShapeKernels &shape, const MonteCarloArgs &args);
+
+  /** @brief draws the given number of samples uniformly inside every
+   *         boundary cell and adds their hits to _cellHits
+   *
+   *  @param const std::vector<uint64_t> & - samples per boundary cell
+   *  @param const uint64_t                - global index of the first
+   *                                         sample of the pass
+   *
+   *  @returns uint64_t - number of shape evaluations
+   * */
+  uint64_t sampleBoundaryCells(const ShapeKernels &shape,
+                               const MonteCarloArgs &args,
+                               PointGenerator &generator,
+                               ParallelEvaluator &evaluator,
+                               const std::vector<uint64_t> &samplesPerCell,
+                               const uint64_t firstSampleIdx);
+
+  //CellType of every cell in row-major order
+  std::vector<uint8_t> _cellTypes;
+
+  //indices of the boundary cells
+  std::vector<uint32_t> _boundaryCells;
+
+  //accumulated samples and hits of every boundary cell
+  std::vector<uint64_t> _cellSamples;
+  std::vector<uint64_t> _cellHits;
+
+  //per-worker hits of the current pass, merged into _cellHits afterwards
+  std::vector<std::vector<uint64_t>> _workerHits;
+
+  //top left corner of the grid and cell size in pixels
+  double _originX = 0.0;
+  double _originY = 0.0;
+  double _cellWidth = 0.0;
+  double _cellHeight = 0.0;
+
+  uint32_t _gridWidth = 0;
+  uint32_t _gridHeight = 0;
+};
+
+#endif /* MONTECARLO_STRATIFIEDESTIMATOR_H_ */
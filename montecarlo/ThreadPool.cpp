@@ -0,0 +1,107 @@
+//Corresponding header
+#include "ThreadPool.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <cstdio>
+#include <system_error>
+
+//Other libraries headers
+
+//Own components headers
+
+ThreadPool::~ThreadPool() {
+  deinit();
+}
+
+int32_t ThreadPool::init(const uint32_t workersCount) {
+  _workersCount = (0 == workersCount) ? 1 : workersCount;
+  _stopRequested = false;
+
+  //the calling thread is worker 0, so spawn one thread less
+  _threads.reserve(_workersCount - 1);
+  for (uint32_t workerId = 1; workerId < _workersCount; ++workerId) {
+    try {
+      _threads.emplace_back(&ThreadPool::workerLoop, this, workerId);
+    } catch (const std::system_error &ex) {
+      fprintf(stderr, "Error, failed to spawn worker thread %u: %s\n",
+          workerId, ex.what());
+      deinit();
+
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+void ThreadPool::deinit() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopRequested = true;
+  }
+  _jobReadyCondVar.notify_all();
+
+  for (std::thread &thread : _threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  _threads.clear();
+  _workersCount = 1;
+}
+
+void ThreadPool::runOnAllWorkers(const Job &job) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _currJob = &job;
+    _pendingWorkers = static_cast<uint32_t>(_threads.size());
+    ++_jobGeneration;
+  }
+  _jobReadyCondVar.notify_all();
+
+  job(0);
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _jobDoneCondVar.wait(lock, [this]() {
+    return 0 == _pendingWorkers;
+  });
+  _currJob = nullptr;
+}
+
+void ThreadPool::workerLoop(const uint32_t workerId) {
+  uint64_t lastGeneration = 0;
+
+  while (true) {
+    const Job *job = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _jobReadyCondVar.wait(lock, [this, lastGeneration]() {
+        return _stopRequested || (lastGeneration != _jobGeneration);
+      });
+
+      if (_stopRequested) {
+        return;
+      }
+
+      lastGeneration = _jobGeneration;
+      job = _currJob;
+    }
+
+    (*job)(workerId);
+
+    bool isLastWorker = false;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      --_pendingWorkers;
+      isLastWorker = (0 == _pendingWorkers);
+    }
+
+    if (isLastWorker) {
+      _jobDoneCondVar.notify_one();
+    }
+  }
+}
@@ -0,0 +1,77 @@
+#ifndef MONTECARLO_THREADPOOL_H_
+#define MONTECARLO_THREADPOOL_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+class ThreadPool {
+public:
+  //the job receives the index of the worker that executes it
+  using Job = std::function<void(const uint32_t workerId)>;
+
+  ThreadPool() = default;
+  ~ThreadPool();
+
+  //forbid the copy and move constructors
+  ThreadPool(const ThreadPool &other) = delete;
+  ThreadPool(ThreadPool &&other) = delete;
+
+  //forbid the copy and move assignment operators
+  ThreadPool& operator=(const ThreadPool &other) = delete;
+  ThreadPool& operator=(ThreadPool &&other) = delete;
+
+  /** @brief used to spawn the worker threads
+   *
+   *  @param const uint32_t - total workers count (including the caller)
+   *
+   *  @returns int32_t      - error code
+   * */
+  int32_t init(const uint32_t workersCount);
+
+  /** @brief used to join all worker threads
+   * */
+  void deinit();
+
+  /** @brief executes the job once on every worker and blocks until
+   *         all of them are done. The calling thread acts as worker 0
+   *
+   *  @param const Job & - job to be executed
+   * */
+  void runOnAllWorkers(const Job &job);
+
+  inline uint32_t getWorkersCount() const {
+    return _workersCount;
+  }
+
+private:
+  void workerLoop(const uint32_t workerId);
+
+  std::vector<std::thread> _threads;
+
+  std::mutex _mutex;
+  std::condition_variable _jobReadyCondVar;
+  std::condition_variable _jobDoneCondVar;
+
+  //job for the current generation. Valid until all workers report done
+  const Job *_currJob = nullptr;
+  uint64_t _jobGeneration = 0;
+  uint32_t _pendingWorkers = 0;
+
+  uint32_t _workersCount = 1;
+  bool _stopRequested = false;
+};
+
+#endif /* MONTECARLO_THREADPOOL_H_ */
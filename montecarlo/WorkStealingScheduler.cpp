@@ -0,0 +1,98 @@
+//Corresponding header
+#include "WorkStealingScheduler.h"
+
+//C system headers
+
+//C++ system headers
+#include <chrono>
+
+//Other libraries headers
+
+//Own components headers
+
+using Time = std::chrono::steady_clock;
+
+void WorkStealingScheduler::reset(const uint32_t workersCount,
+                                  const uint64_t chunksCount) {
+  if (workersCount != _workersCount) {
+    _queues = std::make_unique<ChunkQueue[]>(workersCount);
+    _workersCount = workersCount;
+  }
+
+  for (uint32_t i = 0; i < _workersCount; ++i) {
+    _queues[i].head = (chunksCount * i) / _workersCount;
+    _queues[i].tail = (chunksCount * (i + 1)) / _workersCount;
+  }
+}
+
+void WorkStealingScheduler::runWorker(const uint32_t workerId,
+                                      const ChunkTask &task,
+                                      WorkerStats &outStats) {
+  uint64_t chunkIdx = 0;
+
+  while (true) {
+    if (!popOwnChunk(workerId, chunkIdx)) {
+      if (!stealChunks(workerId, outStats)) {
+        //every queue is empty. Chunks stolen by other workers in the
+        //meantime are processed by the workers that stole them
+        return;
+      }
+
+      continue;
+    }
+
+    const Time::time_point start = Time::now();
+    task(workerId, chunkIdx);
+    const std::chrono::duration<double> elapsed = Time::now() - start;
+
+    outStats.busySeconds += elapsed.count();
+    ++outStats.chunksProcessed;
+  }
+}
+
+bool WorkStealingScheduler::popOwnChunk(const uint32_t workerId,
+                                        uint64_t &outChunkIdx) {
+  ChunkQueue &queue = _queues[workerId];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.head == queue.tail) {
+    return false;
+  }
+
+  outChunkIdx = queue.head;
+  ++queue.head;
+
+  return true;
+}
+
+bool WorkStealingScheduler::stealChunks(const uint32_t workerId,
+                                        WorkerStats &outStats) {
+  for (uint32_t offset = 1; offset < _workersCount; ++offset) {
+    ChunkQueue &victim = _queues[(workerId + offset) % _workersCount];
+
+    uint64_t stolenHead = 0;
+    uint64_t stolenTail = 0;
+    {
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      const uint64_t remaining = victim.tail - victim.head;
+      if (0 == remaining) {
+        continue;
+      }
+
+      //take the back half, rounded up so a single chunk can be stolen
+      const uint64_t stolenCount = (remaining + 1) / 2;
+      stolenTail = victim.tail;
+      stolenHead = stolenTail - stolenCount;
+      victim.tail = stolenHead;
+    }
+
+    ChunkQueue &ownQueue = _queues[workerId];
+    std::lock_guard<std::mutex> lock(ownQueue.mutex);
+    ownQueue.head = stolenHead;
+    ownQueue.tail = stolenTail;
+    outStats.chunksStolen += (stolenTail - stolenHead);
+
+    return true;
+  }
+
+  return false;
+}
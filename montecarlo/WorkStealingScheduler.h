@@ -0,0 +1,68 @@
+#ifndef MONTECARLO_WORKSTEALINGSCHEDULER_H_
+#define MONTECARLO_WORKSTEALINGSCHEDULER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+struct WorkerStats {
+  uint64_t chunksProcessed = 0;
+  uint64_t chunksStolen = 0;
+  double busySeconds = 0.0;
+};
+
+/** @brief distributes chunk indices [0, chunksCount) across the workers.
+ *         Every worker starts with a continuous block of chunks and pops
+ *         them from the front. A worker that runs dry steals the back half
+ *         of the remaining chunks of another worker, so an uneven cost per
+ *         chunk does not leave cores idle
+ * */
+class WorkStealingScheduler {
+public:
+  using ChunkTask = std::function<void(const uint32_t workerId,
+      const uint64_t chunkIdx)>;
+
+  /** @brief prepares the per-worker queues for a new run
+   *
+   *  @param const uint32_t - workers count
+   *  @param const uint64_t - total chunks count
+   * */
+  void reset(const uint32_t workersCount, const uint64_t chunksCount);
+
+  /** @brief processes chunks until there is nothing left to steal.
+   *         Must be invoked concurrently from every worker
+   *
+   *  @param const uint32_t    - index of the calling worker
+   *  @param const ChunkTask & - task evaluating a single chunk
+   *  @param WorkerStats &     - statistics of the calling worker
+   * */
+  void runWorker(const uint32_t workerId, const ChunkTask &task,
+                 WorkerStats &outStats);
+
+private:
+  //chunks in range [head, tail) still waiting for processing
+  struct alignas(64) ChunkQueue {
+    std::mutex mutex;
+    uint64_t head = 0;
+    uint64_t tail = 0;
+  };
+
+  bool popOwnChunk(const uint32_t workerId, uint64_t &outChunkIdx);
+
+  bool stealChunks(const uint32_t workerId, WorkerStats &outStats);
+
+  std::unique_ptr<ChunkQueue[]> _queues;
+  uint32_t _workersCount = 0;
+};
+
+#endif /* MONTECARLO_WORKSTEALINGSCHEDULER_H_ */
@@ -0,0 +1,50 @@
+//Corresponding header
+#include "HaltonSampler.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/SamplerUtils.hpp"
+
+namespace {
+double radicalInverseBase3(uint64_t idx) {
+  constexpr double INV_BASE = 1.0 / 3.0;
+
+  double result = 0.0;
+  double digitWeight = INV_BASE;
+  while (0 != idx) {
+    result += static_cast<double>(idx % 3) * digitWeight;
+    idx /= 3;
+    digitWeight *= INV_BASE;
+  }
+
+  return result;
+}
+
+inline double wrapUnit(const double value) {
+  return (1.0 <= value) ? (value - 1.0) : value;
+}
+}
+
+HaltonSampler::HaltonSampler(const uint64_t seed)
+    : _shiftX(SamplerUtils::toUnitDouble(SamplerUtils::mix64(seed))),
+      _shiftY(SamplerUtils::toUnitDouble(SamplerUtils::mix64(~seed))) {
+
+}
+
+void HaltonSampler::generate(const uint32_t, const uint64_t firstIdx,
+                             const size_t count, double *outXs,
+                             double *outYs) {
+  for (size_t i = 0; i < count; ++i) {
+    const uint64_t idx = firstIdx + i;
+
+    //the radical inverse in base 2 is the bit-reversed index
+    outXs[i] = wrapUnit(SamplerUtils::toUnitDouble(
+        SamplerUtils::reverseBits64(idx)) + _shiftX);
+    outYs[i] = wrapUnit(radicalInverseBase3(idx) + _shiftY);
+  }
+}
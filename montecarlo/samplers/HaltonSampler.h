@@ -0,0 +1,39 @@
+#ifndef MONTECARLO_SAMPLERS_HALTONSAMPLER_H_
+#define MONTECARLO_SAMPLERS_HALTONSAMPLER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/Sampler.h"
+
+//Forward declarations
+
+/** @brief 2D Halton sequence in bases 2 and 3, randomized with a
+ *         seeded Cranley-Patterson rotation (a random shift modulo 1)
+ * */
+class HaltonSampler : public Sampler {
+public:
+  explicit HaltonSampler(const uint64_t seed);
+
+  void generate(const uint32_t workerId, const uint64_t firstIdx,
+                const size_t count, double *outXs, double *outYs) override;
+
+  bool isIndexAddressable() const override {
+    return true;
+  }
+
+  const char* getName() const override {
+    return "halton";
+  }
+
+private:
+  double _shiftX;
+  double _shiftY;
+};
+
+#endif /* MONTECARLO_SAMPLERS_HALTONSAMPLER_H_ */
@@ -0,0 +1,35 @@
+//Corresponding header
+#include "MersenneTwisterSampler.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+
+MersenneTwisterSampler::MersenneTwisterSampler(const uint32_t workersCount,
+                                               const uint64_t seed) {
+  _engines.reserve(workersCount);
+  for (uint32_t workerId = 0; workerId < workersCount; ++workerId) {
+    //mix the worker index into the seed so the streams do not overlap
+    std::seed_seq seedSeq { static_cast<uint32_t>(seed),
+        static_cast<uint32_t>(seed >> 32), workerId };
+    _engines.emplace_back(seedSeq);
+  }
+}
+
+void MersenneTwisterSampler::generate(const uint32_t workerId,
+                                      const uint64_t, const size_t count,
+                                      double *outXs, double *outYs) {
+  std::mt19937 &engine = _engines[workerId];
+
+  /* we NEED uniform distribution for Monte Carlo */
+  std::uniform_real_distribution<> distr(0, 1.0);
+
+  for (size_t i = 0; i < count; ++i) {
+    outXs[i] = distr(engine);
+    outYs[i] = distr(engine);
+  }
+}
@@ -0,0 +1,40 @@
+#ifndef MONTECARLO_SAMPLERS_MERSENNETWISTERSAMPLER_H_
+#define MONTECARLO_SAMPLERS_MERSENNETWISTERSAMPLER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <vector>
+#include <random>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/Sampler.h"
+
+//Forward declarations
+
+/** @brief every worker owns a separately seeded std::mt19937 engine and
+ *         consumes it sequentially. The sample indices are ignored
+ * */
+class MersenneTwisterSampler : public Sampler {
+public:
+  MersenneTwisterSampler(const uint32_t workersCount, const uint64_t seed);
+
+  void generate(const uint32_t workerId, const uint64_t firstIdx,
+                const size_t count, double *outXs, double *outYs) override;
+
+  bool isIndexAddressable() const override {
+    return false;
+  }
+
+  const char* getName() const override {
+    return "mt19937";
+  }
+
+private:
+  std::vector<std::mt19937> _engines;
+};
+
+#endif /* MONTECARLO_SAMPLERS_MERSENNETWISTERSAMPLER_H_ */
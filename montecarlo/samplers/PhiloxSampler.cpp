@@ -0,0 +1,27 @@
+//Corresponding header
+#include "PhiloxSampler.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/SamplerUtils.hpp"
+
+PhiloxSampler::PhiloxSampler(const uint64_t seed) : _philox(seed) {
+
+}
+
+void PhiloxSampler::generate(const uint32_t, const uint64_t firstIdx,
+                             const size_t count, double *outXs,
+                             double *outYs) {
+  for (size_t i = 0; i < count; ++i) {
+    const Philox4x32::Block block = _philox.generate(firstIdx + i);
+    outXs[i] = SamplerUtils::toUnitDouble(
+        (static_cast<uint64_t>(block.v[0]) << 32) | block.v[1]);
+    outYs[i] = SamplerUtils::toUnitDouble(
+        (static_cast<uint64_t>(block.v[2]) << 32) | block.v[3]);
+  }
+}
@@ -0,0 +1,39 @@
+#ifndef MONTECARLO_SAMPLERS_PHILOXSAMPLER_H_
+#define MONTECARLO_SAMPLERS_PHILOXSAMPLER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/Sampler.h"
+#include "montecarlo/Philox.hpp"
+
+//Forward declarations
+
+/** @brief sample i is a pure function of (seed, i). A single Philox block
+ *         provides 64 random bits for each coordinate
+ * */
+class PhiloxSampler : public Sampler {
+public:
+  explicit PhiloxSampler(const uint64_t seed);
+
+  void generate(const uint32_t workerId, const uint64_t firstIdx,
+                const size_t count, double *outXs, double *outYs) override;
+
+  bool isIndexAddressable() const override {
+    return true;
+  }
+
+  const char* getName() const override {
+    return "philox4x32-10";
+  }
+
+private:
+  Philox4x32 _philox;
+};
+
+#endif /* MONTECARLO_SAMPLERS_PHILOXSAMPLER_H_ */
@@ -0,0 +1,37 @@
+//Corresponding header
+#include "R2Sampler.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/SamplerUtils.hpp"
+
+namespace {
+//1 / g and 1 / g^2 in 0.64 fixed point, g = 1.32471795724474602596...
+constexpr uint64_t ALPHA_X = 0xC13FA9A902A6328Full;
+constexpr uint64_t ALPHA_Y = 0x91E10DA5C79E7B1Cull;
+}
+
+R2Sampler::R2Sampler(const uint64_t seed)
+    : _shiftX(SamplerUtils::mix64(seed)),
+      _shiftY(SamplerUtils::mix64(~seed)) {
+
+}
+
+void R2Sampler::generate(const uint32_t, const uint64_t firstIdx,
+                         const size_t count, double *outXs, double *outYs) {
+  //unsigned overflow implements the modulo 1 for free
+  uint64_t currX = _shiftX + (firstIdx * ALPHA_X);
+  uint64_t currY = _shiftY + (firstIdx * ALPHA_Y);
+
+  for (size_t i = 0; i < count; ++i) {
+    outXs[i] = SamplerUtils::toUnitDouble(currX);
+    outYs[i] = SamplerUtils::toUnitDouble(currY);
+    currX += ALPHA_X;
+    currY += ALPHA_Y;
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef MONTECARLO_SAMPLERS_R2SAMPLER_H_
+#define MONTECARLO_SAMPLERS_R2SAMPLER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/Sampler.h"
+
+//Forward declarations
+
+/** @brief R2 additive recurrence (Roberts, 2018):
+ *         x_i = frac(s + i / g), y_i = frac(s + i / g^2), where g is the
+ *         plastic number. Evaluated in 64 bit fixed point, so the
+ *         precision does not degrade for big sample indices
+ * */
+class R2Sampler : public Sampler {
+public:
+  explicit R2Sampler(const uint64_t seed);
+
+  void generate(const uint32_t workerId, const uint64_t firstIdx,
+                const size_t count, double *outXs, double *outYs) override;
+
+  bool isIndexAddressable() const override {
+    return true;
+  }
+
+  const char* getName() const override {
+    return "r2";
+  }
+
+private:
+  //seeded random start offsets in 64 bit fixed point
+  uint64_t _shiftX;
+  uint64_t _shiftY;
+};
+
+#endif /* MONTECARLO_SAMPLERS_R2SAMPLER_H_ */
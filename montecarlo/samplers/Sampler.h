@@ -0,0 +1,43 @@
+#ifndef MONTECARLO_SAMPLERS_SAMPLER_H_
+#define MONTECARLO_SAMPLERS_SAMPLER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief source of 2D sample points in the unit square [0, 1)^2
+ * */
+class Sampler {
+public:
+  virtual ~Sampler() = default;
+
+  /** @brief generates the samples with global indices
+   *         [firstIdx, firstIdx + count)
+   *
+   *  @param const uint32_t - index of the calling worker
+   *  @param const uint64_t - global index of the first sample
+   *  @param const size_t   - number of samples to be generated
+   *  @param double *       - output x coordinates in range [0, 1)
+   *  @param double *       - output y coordinates in range [0, 1)
+   * */
+  virtual void generate(const uint32_t workerId, const uint64_t firstIdx,
+                        const size_t count, double *outXs,
+                        double *outYs) = 0;
+
+  /** @brief whether generate() depends only on the sample indices, so
+   *         sub-ranges can be generated independently and in any order
+   * */
+  virtual bool isIndexAddressable() const = 0;
+
+  virtual const char* getName() const = 0;
+};
+
+#endif /* MONTECARLO_SAMPLERS_SAMPLER_H_ */
@@ -0,0 +1,40 @@
+//Corresponding header
+#include "SamplerFactory.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "montecarlo/samplers/MersenneTwisterSampler.h"
+#include "montecarlo/samplers/PhiloxSampler.h"
+#include "montecarlo/samplers/SobolSampler.h"
+#include "montecarlo/samplers/HaltonSampler.h"
+#include "montecarlo/samplers/R2Sampler.h"
+
+std::unique_ptr<Sampler> SamplerFactory::create(const uint8_t samplerType,
+                                                const uint32_t workersCount,
+                                                const uint64_t seed) {
+  switch (samplerType) {
+  case SamplerType::MT19937:
+    return std::make_unique<MersenneTwisterSampler>(workersCount, seed);
+
+  case SamplerType::PHILOX:
+    return std::make_unique<PhiloxSampler>(seed);
+
+  case SamplerType::SOBOL:
+    return std::make_unique<SobolSampler>(seed);
+
+  case SamplerType::HALTON:
+    return std::make_unique<HaltonSampler>(seed);
+
+  case SamplerType::R2:
+    return std::make_unique<R2Sampler>(seed);
+
+  default:
+    return nullptr;
+  }
+}
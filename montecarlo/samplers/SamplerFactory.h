@@ -0,0 +1,35 @@
+#ifndef MONTECARLO_SAMPLERS_SAMPLERFACTORY_H_
+#define MONTECARLO_SAMPLERS_SAMPLERFACTORY_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <memory>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/Sampler.h"
+
+//Forward declarations
+
+class SamplerFactory {
+public:
+  ~SamplerFactory() = delete;
+
+  /** @brief used to create a seeded sampler
+   *
+   *  @param const uint8_t  - SamplerType to be created
+   *  @param const uint32_t - number of workers that will use the sampler
+   *  @param const uint64_t - seed of the sampler
+   *
+   *  @returns std::unique_ptr<Sampler> - the created sampler or nullptr
+   *                                      for unknown sampler types
+   * */
+  static std::unique_ptr<Sampler> create(const uint8_t samplerType,
+                                         const uint32_t workersCount,
+                                         const uint64_t seed);
+};
+
+#endif /* MONTECARLO_SAMPLERS_SAMPLERFACTORY_H_ */
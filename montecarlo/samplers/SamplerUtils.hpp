@@ -0,0 +1,43 @@
+#ifndef MONTECARLO_SAMPLERS_SAMPLERUTILS_HPP_
+#define MONTECARLO_SAMPLERS_SAMPLERUTILS_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+namespace SamplerUtils {
+//SplitMix64 finalizer - derives well distributed sub-seeds from a seed
+inline uint64_t mix64(uint64_t value) {
+  value += 0x9E3779B97F4A7C15ull;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
+
+//maps the 53 most significant bits into range [0, 1)
+inline double toUnitDouble(const uint64_t bits) {
+  return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
+inline uint32_t reverseBits32(uint32_t value) {
+  value = ( (value >> 1) & 0x55555555u) | ( (value & 0x55555555u) << 1);
+  value = ( (value >> 2) & 0x33333333u) | ( (value & 0x33333333u) << 2);
+  value = ( (value >> 4) & 0x0F0F0F0Fu) | ( (value & 0x0F0F0F0Fu) << 4);
+  value = ( (value >> 8) & 0x00FF00FFu) | ( (value & 0x00FF00FFu) << 8);
+  return (value >> 16) | (value << 16);
+}
+
+inline uint64_t reverseBits64(const uint64_t value) {
+  return (static_cast<uint64_t>(reverseBits32(static_cast<uint32_t>(value)))
+      << 32) | reverseBits32(static_cast<uint32_t>(value >> 32));
+}
+}
+
+#endif /* MONTECARLO_SAMPLERS_SAMPLERUTILS_HPP_ */
@@ -0,0 +1,80 @@
+//Corresponding header
+#include "SobolSampler.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/SamplerUtils.hpp"
+
+namespace {
+//Laine-Karras style permutation. Operates on bit-reversed values, so
+//every bit is only affected by the bits below it (nested scrambling)
+uint32_t laineKarrasPermutation(uint32_t value, const uint32_t seed) {
+  value += seed;
+  value ^= value * 0x6C50B47Cu;
+  value ^= value * 0xB82F1E52u;
+  value ^= value * 0xC7AFE638u;
+  value ^= value * 0x8D22F6E6u;
+  return value;
+}
+
+uint32_t owenScramble(const uint32_t value, const uint32_t seed) {
+  return SamplerUtils::reverseBits32(laineKarrasPermutation(
+      SamplerUtils::reverseBits32(value), seed));
+}
+}
+
+SobolSampler::SobolSampler(const uint64_t seed) : _seed(seed) {
+  for (int32_t bit = 0; bit < BITS; ++bit) {
+    //first dimension is the van der Corput sequence in base 2
+    _directions[0][bit] = 1u << (BITS - 1 - bit);
+  }
+
+  //second dimension uses the primitive polynomial x + 1 (m1 = 1)
+  _directions[1][0] = 1u << (BITS - 1);
+  for (int32_t bit = 1; bit < BITS; ++bit) {
+    _directions[1][bit] =
+        _directions[1][bit - 1] ^ (_directions[1][bit - 1] >> 1);
+  }
+}
+
+void SobolSampler::generate(const uint32_t, const uint64_t firstIdx,
+                            const size_t count, double *outXs,
+                            double *outYs) {
+  constexpr double TO_UNIT = 1.0 / 4294967296.0;
+
+  uint64_t currEpoch = UINT64_MAX;
+  uint32_t seedX = 0;
+  uint32_t seedY = 0;
+
+  for (size_t i = 0; i < count; ++i) {
+    const uint64_t idx = firstIdx + i;
+
+    //new scramble seeds for every 2^32 samples
+    const uint64_t epoch = idx >> 32;
+    if (epoch != currEpoch) {
+      currEpoch = epoch;
+      const uint64_t epochSeed = SamplerUtils::mix64(_seed + epoch);
+      seedX = static_cast<uint32_t>(epochSeed);
+      seedY = static_cast<uint32_t>(epochSeed >> 32);
+    }
+
+    uint32_t sobolX = 0;
+    uint32_t sobolY = 0;
+    int32_t bit = 0;
+    for (uint32_t bits = static_cast<uint32_t>(idx); 0 != bits;
+        bits >>= 1, ++bit) {
+      if (bits & 1u) {
+        sobolX ^= _directions[0][bit];
+        sobolY ^= _directions[1][bit];
+      }
+    }
+
+    outXs[i] = owenScramble(sobolX, seedX) * TO_UNIT;
+    outYs[i] = owenScramble(sobolY, seedY) * TO_UNIT;
+  }
+}
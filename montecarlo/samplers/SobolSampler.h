@@ -0,0 +1,47 @@
+#ifndef MONTECARLO_SAMPLERS_SOBOLSAMPLER_H_
+#define MONTECARLO_SAMPLERS_SOBOLSAMPLER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/samplers/Sampler.h"
+
+//Forward declarations
+
+/** @brief 2D Sobol sequence with hash-based Owen scrambling
+ *         (Burley, "Practical Hash-based Owen Scrambling", JCGT 2020).
+ *         The unscrambled sequence has 32 bits of precision, so every
+ *         block of 2^32 samples uses an independent scramble
+ * */
+class SobolSampler : public Sampler {
+public:
+  explicit SobolSampler(const uint64_t seed);
+
+  void generate(const uint32_t workerId, const uint64_t firstIdx,
+                const size_t count, double *outXs, double *outYs) override;
+
+  bool isIndexAddressable() const override {
+    return true;
+  }
+
+  const char* getName() const override {
+    return "sobol-owen";
+  }
+
+private:
+  enum InternalDefines {
+    DIMENSIONS = 2,
+    BITS = 32
+  };
+
+  uint32_t _directions[DIMENSIONS][BITS];
+
+  uint64_t _seed;
+};
+
+#endif /* MONTECARLO_SAMPLERS_SOBOLSAMPLER_H_ */
@@ -0,0 +1,39 @@
+#ifndef MONTECARLO_SHAPES_ANNULUSSHAPE_HPP_
+#define MONTECARLO_SHAPES_ANNULUSSHAPE_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cmath>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+//ring between two concentric circles around the origin
+struct AnnulusShape {
+  static constexpr const char *NAME = "annulus";
+
+  static constexpr double INNER_RADIUS = 2.0;
+  static constexpr double OUTER_RADIUS = 3.5;
+
+  //radii of the bounding ellipse in shape units
+  static constexpr double BOUNDING_RADIUS_X = 8.0;
+  static constexpr double BOUNDING_RADIUS_Y = 4.0;
+
+  static constexpr bool HAS_ANALYTIC_AREA = true;
+  static constexpr double ANALYTIC_AREA = M_PI
+      * ((OUTER_RADIUS * OUTER_RADIUS) - (INNER_RADIUS * INNER_RADIUS));
+
+  static inline bool contains(const double posX, const double posY) {
+    //compare the squared distances - no square root needed
+    const double distanceSq = (posX * posX) + (posY * posY);
+
+    return (distanceSq >= INNER_RADIUS * INNER_RADIUS)
+        && (distanceSq <= OUTER_RADIUS * OUTER_RADIUS);
+  }
+};
+
+#endif /* MONTECARLO_SHAPES_ANNULUSSHAPE_HPP_ */
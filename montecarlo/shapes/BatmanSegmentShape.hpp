@@ -0,0 +1,116 @@
+#ifndef MONTECARLO_SHAPES_BATMANSEGMENTSHAPE_HPP_
+#define MONTECARLO_SHAPES_BATMANSEGMENTSHAPE_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cmath>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/BatmanConstants.h"
+#include "montecarlo/shapes/BatmanShape.hpp"
+
+//Forward declarations
+
+/** @brief branchless reformulation of BatmanShape::contains().
+ *
+ *         The segment of the outline is selected once from the x
+ *         coordinate (and the half of the plane) through a constexpr
+ *         table, instead of walking the chain of range checks. All
+ *         formulas are compared in squared space, so no square roots are
+ *         taken. Every formula is cheap without the roots, so all of them
+ *         are evaluated and the table only selects the result.
+ *
+ *         The results match BatmanShape::contains() except for points
+ *         within a rounding error of the outline
+ * */
+struct BatmanSegmentShape : BatmanShape {
+  static inline bool contains(const double posX, const double posY) {
+    using BatmanConstants::HASH_1;
+    using BatmanConstants::HASH_2;
+    using BatmanConstants::HASH_3;
+
+    const double absX = fabs(posX);
+    const double squareX = posX * posX;
+    const double squareY = posY * posY;
+
+    /* upper segments are delimited by x = -3, -1, -0.75, -0.5, 0.5, 0.75,
+     * 1, 3 and lower ones by x = -4, 4. A point on a delimiter belongs to
+     * the segment on its left */
+    const uint32_t upperIdx = (posX > -3.0) + (posX > -1.0) + (posX > -0.75)
+        + (posX > -0.5) + (posX > 0.5) + (posX > 0.75) + (posX > 1.0)
+        + (posX > 3.0);
+    const uint32_t lowerIdx =
+        UPPER_SEGMENTS_COUNT + (posX > -4.0) + (posX > 4.0);
+
+    //selected with a mask - a conditional is compiled to a branch, which
+    //is mispredicted for half of the uniformly distributed points
+    const uint32_t upperMask = 0u - static_cast<uint32_t>(posY < 0.0);
+    const Segment &segment =
+        SEGMENTS[(upperIdx & upperMask) | (lowerIdx & ~upperMask)];
+
+    /* wings: |x| <= 7 * sqrt(1 - y^2 / 9) */
+    const bool wing = squareX <= 49.0 * (1.0 - (squareY * (1.0 / 9.0)));
+
+    /* shoulders: y > H2 * sqrt(4 - (|x| - 1)^2) - (H1 + 1.5 - 0.5 * |x|) */
+    const double shoulderHash = absX - 1.0;
+    const double shoulderLhs = posY + HASH_1 + (1.5 - 0.5 * absX);
+    const bool shoulder = (0.0 < shoulderLhs) & ( (shoulderLhs * shoulderLhs)
+        > (HASH_2 * HASH_2) * (4.0 - (shoulderHash * shoulderHash)));
+
+    /* ears and top of head: y > -(a + b * x) */
+    const bool head = (posY + segment.offset + segment.slope * posX) > 0.0;
+
+    /* bottom: y < -(|x / 2| - H3 * x^2 - 3 + sqrt(1 - h^2)),
+     * where h = ||x| - 2| - 1 */
+    const double bottomHash = fabs(absX - 2.0) - 1.0;
+    const double bottomRhs = (3.0 + HASH_3 * squareX) - (0.5 * absX) - posY;
+    const bool bottom = (0.0 < bottomRhs) & ( (bottomRhs * bottomRhs)
+        > (1.0 - (bottomHash * bottomHash)));
+
+    const uint32_t results = static_cast<uint32_t>(wing)
+        | (static_cast<uint32_t>(shoulder) << SHOULDER)
+        | (static_cast<uint32_t>(head) << HEAD)
+        | (static_cast<uint32_t>(bottom) << BOTTOM);
+
+    return (results >> segment.formula) & 1;
+  }
+
+private:
+  enum Formula : uint8_t {
+    WING, SHOULDER, HEAD, BOTTOM
+  };
+
+  struct Segment {
+    uint8_t formula;
+
+    //coefficients of the HEAD formula
+    double offset;
+    double slope;
+  };
+
+  static constexpr uint32_t UPPER_SEGMENTS_COUNT = 9;
+
+  static constexpr Segment SEGMENTS[] = {
+      /* upper half, from left to right */
+      { WING, 0.0, 0.0 },       /* left upper wing */
+      { SHOULDER, 0.0, 0.0 },   /* left shoulder */
+      { HEAD, 9.0, 8.0 },       /* exterior left ear */
+      { HEAD, 0.75, -3.0 },     /* interior left ear */
+      { HEAD, 2.25, 0.0 },      /* top of head */
+      { HEAD, 0.75, 3.0 },      /* interior right ear */
+      { HEAD, 9.0, -8.0 },      /* exterior right ear */
+      { SHOULDER, 0.0, 0.0 },   /* right shoulder */
+      { WING, 0.0, 0.0 },       /* right upper wing */
+
+      /* lower half, from left to right */
+      { WING, 0.0, 0.0 },       /* bottom left wing */
+      { BOTTOM, 0.0, 0.0 },     /* bottom wing */
+      { WING, 0.0, 0.0 }        /* bottom right wing */
+  };
+};
+
+#endif /* MONTECARLO_SHAPES_BATMANSEGMENTSHAPE_HPP_ */
@@ -0,0 +1,124 @@
+#ifndef MONTECARLO_SHAPES_BATMANSHAPE_HPP_
+#define MONTECARLO_SHAPES_BATMANSHAPE_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cmath>
+
+//Other libraries headers
+
+//Own components headers
+#include "montecarlo/BatmanConstants.h"
+
+//Forward declarations
+
+/** @brief the Batman logo. The shape coordinates have the y axis pointing
+ *         down (as the screen), so negative y is the upper half
+ * */
+struct BatmanShape {
+  static constexpr const char *NAME = "batman";
+
+  //radii of the bounding ellipse in shape units
+  static constexpr double BOUNDING_RADIUS_X = 8.0;
+  static constexpr double BOUNDING_RADIUS_Y = 4.0;
+
+  static constexpr bool HAS_ANALYTIC_AREA = true;
+  static constexpr double ANALYTIC_AREA = 48.4243597;
+
+  static inline bool contains(const double posX, const double posY) {
+    using BatmanConstants::HASH_1;
+    using BatmanConstants::HASH_2;
+    using BatmanConstants::HASH_3;
+
+    double tempX = 0.0;
+    double tempY = 0.0;
+
+    if (posY < 0.0) {
+      /* left upper wing */
+      if (posX <= -3) {
+        tempX = (-7 * sqrt(1 - ( (posY * posY) / 9.0)));
+        return posX >= tempX;
+      }
+
+      /* left shoulder */
+      if (posX > -3.0 && posX <= -1.0) {
+        tempX = -posX;
+        const double LOC_HASH = fabs(tempX) - 1;
+        tempY = - (HASH_1 + (1.5 - 0.5 * tempX))
+            + HASH_2 * sqrt(4.0 - (LOC_HASH * LOC_HASH));
+        return posY > tempY;
+      }
+
+      /* exterior left ear */
+      if (posX > -1.0 && posX <= -0.75) {
+        tempY = 9.0 + 8.0 * posX;
+        return posY > -tempY;
+      }
+
+      /* interior left ear */
+      if (posX > -0.75 && posX <= -0.5) {
+        tempY = -3 * posX + 0.75;
+        return posY > -tempY;
+      }
+
+      /* top of head */
+      if (posX > -0.5 && posX <= 0.5) {
+        tempY = 2.25;
+        return posY > -tempY;
+      }
+
+      /* interior right ear */
+      if (posX > 0.5 && posX <= 0.75) {
+        tempY = 3 * posX + 0.75;
+        return posY > -tempY;
+      }
+
+      /* exterior right ear */
+      if (posX > 0.75 && posX <= 1.0) {
+        tempY = 9.0 - 8 * posX;
+        return posY > -tempY;
+      }
+
+      /* right shoulder */
+      if (posX <= 3.0 && posX > 1.0) {
+        const double LOC_HASH = fabs(posX) - 1.0;
+        tempY = - (HASH_1 + (1.5 - 0.5 * posX))
+            + HASH_2 * sqrt(4.0 - (LOC_HASH * LOC_HASH));
+        return posY > tempY;
+      }
+
+      /* right upper wing */
+      if (posX > 3.0) {
+        tempX = (7.0 * sqrt(1 - ( (posY * posY) / 9.0)));
+        return posX <= tempX;
+      }
+    }
+    if (posY >= 0) {
+      /* bottom left wing */
+      if (posX <= -4.0) {
+        tempX = (-7 * sqrt(1 - ( (posY * posY) / 9.0)));
+        return posX >= tempX;
+      }
+
+      /* bottom wing */
+      if (posX > -4.0 && posX <= 4.0) {
+        const double LOC_HASH = fabs(fabs(posX) - 2.0) - 1.0;
+        tempY = (fabs(posX / 2) - (HASH_3 * posX * posX) - 3.0)
+            + sqrt(1 - (LOC_HASH * LOC_HASH));
+        tempY *= -1.0;
+        return posY < tempY;
+      }
+
+      /* bottom right wing */
+      if (posX >= 4.0) {
+        tempX = (7.0 * sqrt(1 - ( (posY * posY) / 9.0)));
+        return posX <= tempX;
+      }
+    }
+
+    return false;
+  }
+};
+
+#endif /* MONTECARLO_SHAPES_BATMANSHAPE_HPP_ */
@@ -0,0 +1,37 @@
+#ifndef MONTECARLO_SHAPES_ELLIPSESHAPE_HPP_
+#define MONTECARLO_SHAPES_ELLIPSESHAPE_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cmath>
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+//axis aligned ellipse with radii 6 and 3 around the origin
+struct EllipseShape {
+  static constexpr const char *NAME = "ellipse";
+
+  static constexpr double RADIUS_X = 6.0;
+  static constexpr double RADIUS_Y = 3.0;
+
+  //radii of the bounding ellipse in shape units
+  static constexpr double BOUNDING_RADIUS_X = 8.0;
+  static constexpr double BOUNDING_RADIUS_Y = 4.0;
+
+  static constexpr bool HAS_ANALYTIC_AREA = true;
+  static constexpr double ANALYTIC_AREA = M_PI * RADIUS_X * RADIUS_Y;
+
+  static inline bool contains(const double posX, const double posY) {
+    const double deltaX = posX / RADIUS_X;
+    const double deltaY = posY / RADIUS_Y;
+
+    return (deltaX * deltaX) + (deltaY * deltaY) <= 1.0;
+  }
+};
+
+#endif /* MONTECARLO_SHAPES_ELLIPSESHAPE_HPP_ */
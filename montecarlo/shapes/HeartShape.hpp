@@ -0,0 +1,41 @@
+#ifndef MONTECARLO_SHAPES_HEARTSHAPE_HPP_
+#define MONTECARLO_SHAPES_HEARTSHAPE_HPP_
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+
+//Forward declarations
+
+/** @brief the algebraic heart curve (x^2 + y^2 - 1)^3 - x^2 * y^3 <= 0
+ *         scaled 3 times. Its area has no simple closed form, so only the
+ *         confidence interval of the estimate is available
+ * */
+struct HeartShape {
+  static constexpr const char *NAME = "heart";
+
+  static constexpr double SCALE = 3.0;
+
+  //radii of the bounding ellipse in shape units
+  static constexpr double BOUNDING_RADIUS_X = 8.0;
+  static constexpr double BOUNDING_RADIUS_Y = 4.0;
+
+  static constexpr bool HAS_ANALYTIC_AREA = false;
+  static constexpr double ANALYTIC_AREA = 0.0;
+
+  static inline bool contains(const double posX, const double posY) {
+    //the curve equation has the y axis pointing up
+    const double x = posX / SCALE;
+    const double y = -posY / SCALE;
+    const double xSq = x * x;
+    const double base = xSq + (y * y) - 1.0;
+
+    return (base * base * base) - (xSq * y * y * y) <= 0.0;
+  }
+};
+
+#endif /* MONTECARLO_SHAPES_HEARTSHAPE_HPP_ */
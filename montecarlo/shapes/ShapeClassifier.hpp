@@ -0,0 +1,108 @@
+#ifndef MONTECARLO_SHAPES_SHAPECLASSIFIER_HPP_
+#define MONTECARLO_SHAPES_SHAPECLASSIFIER_HPP_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+
+/** @brief Monte Carlo classification of screen points against a shape.
+ *
+ *         A Shape is any type providing:
+ *           static constexpr const char *NAME;
+ *           static constexpr double BOUNDING_RADIUS_X, BOUNDING_RADIUS_Y;
+ *           static constexpr bool HAS_ANALYTIC_AREA;
+ *           static constexpr double ANALYTIC_AREA;
+ *           static bool contains(const double x, const double y);
+ *
+ *         in shape units, where the shape is centered at the origin and
+ *         the y axis points down. The shape must lie inside the ellipse
+ *         with the bounding radii. The template is instantiated per shape,
+ *         so contains() is inlined into the loops below
+ * */
+template <typename Shape>
+class ShapeClassifier {
+public:
+  ~ShapeClassifier() = delete;
+
+  /** @brief classifies a single point in screen coordinates
+   *
+   *  @param const double           - x coordinate of the point
+   *  @param const double           - y coordinate of the point
+   *  @param const MonteCarloArgs & - integration arguments
+   *
+   *  @returns uint8_t              - PointRegion of the point
+   * */
+  static inline uint8_t classify(const double x, const double y,
+                                 const MonteCarloArgs &args) {
+    const double posX = x - args.animationCenter.x;
+    const double posY = y - args.animationCenter.y;
+    const double deltaX = posX / args.ovalRadius.x;
+    const double deltaY = posY / args.ovalRadius.y;
+    if ((deltaX * deltaX) + (deltaY * deltaY) > 1.0) {
+      return PointRegion::OUT_OF_BOUNDS;
+    }
+
+    return Shape::contains(posX / args.animationScale,
+        posY / args.animationScale) ? PointRegion::INSIDE_SHAPE :
+                                      PointRegion::OUTSIDE_SHAPE;
+  }
+
+  /** @brief classifies a continuous range of points
+   *
+   *  @param const double *         - x coordinates of the points
+   *  @param const double *         - y coordinates of the points
+   *  @param const size_t           - number of points in the range
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param uint8_t *              - PointRegion of every point
+   * */
+  static void classifyRange(const double *xs, const double *ys,
+                            const size_t count, const MonteCarloArgs &args,
+                            uint8_t *outRegions) {
+    for (size_t i = 0; i < count; ++i) {
+      outRegions[i] = classify(xs[i], ys[i], args);
+    }
+  }
+
+  /** @brief classifies a continuous range of points and accumulates the
+   *         result into the provided counters. Single precision points
+   *         are classified in double precision
+   *
+   *  @param const Real *           - x coordinates of the points
+   *  @param const Real *           - y coordinates of the points
+   *  @param const size_t           - number of points in the range
+   *  @param const MonteCarloArgs & - integration arguments
+   *  @param EvaluationCounters &   - counters to be accumulated
+   * */
+  template <typename Real>
+  static void evaluate(const Real *xs, const Real *ys,
+                       const size_t count, const MonteCarloArgs &args,
+                       EvaluationCounters &outCounters) {
+    //accumulate into stack variables so the hot loop does not
+    //write through the output reference on every point
+    uint64_t pointsInBounds = 0;
+    uint64_t pointsInShape = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+      const uint8_t region = classify(static_cast<double>(xs[i]),
+          static_cast<double>(ys[i]), args);
+      pointsInBounds += (PointRegion::OUT_OF_BOUNDS != region);
+      pointsInShape += (PointRegion::INSIDE_SHAPE == region);
+    }
+
+    outCounters.totalPoints += count;
+    outCounters.pointsInOval += pointsInBounds;
+    outCounters.pointsInBatman += pointsInShape;
+  }
+};
+
+#endif /* MONTECARLO_SHAPES_SHAPECLASSIFIER_HPP_ */
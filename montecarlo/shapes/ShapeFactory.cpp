@@ -0,0 +1,78 @@
+//Corresponding header
+#include "ShapeFactory.h"
+
+//C system headers
+
+//C++ system headers
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonDefines.h"
+#include "montecarlo/BatchClassifier.h"
+#include "montecarlo/shapes/ShapeClassifier.hpp"
+#include "montecarlo/shapes/BatmanShape.hpp"
+#include "montecarlo/shapes/EllipseShape.hpp"
+#include "montecarlo/shapes/AnnulusShape.hpp"
+#include "montecarlo/shapes/HeartShape.hpp"
+
+namespace {
+template <typename Shape, typename Real>
+void evaluateShape(const Real *xs, const Real *ys, const size_t count,
+                   const MonteCarloArgs &args, const uint8_t,
+                   EvaluationCounters &outCounters) {
+  ShapeClassifier<Shape>::evaluate(xs, ys, count, args, outCounters);
+}
+
+//the Batman has dedicated SIMD and segment table kernels
+template <>
+void evaluateShape<BatmanShape, double>(const double *xs, const double *ys,
+                                        const size_t count,
+                                        const MonteCarloArgs &args,
+                                        const uint8_t kernel,
+                                        EvaluationCounters &outCounters) {
+  BatchClassifier::evaluate(xs, ys, count, args, kernel, outCounters);
+}
+
+template <>
+void evaluateShape<BatmanShape, float>(const float *xs, const float *ys,
+                                       const size_t count,
+                                       const MonteCarloArgs &args,
+                                       const uint8_t kernel,
+                                       EvaluationCounters &outCounters) {
+  BatchClassifier::evaluate(xs, ys, count, args, kernel, outCounters);
+}
+
+template <typename Shape>
+constexpr ShapeKernels makeShapeKernels(const bool honorsClassifierKernel) {
+  return ShapeKernels { Shape::NAME, Shape::BOUNDING_RADIUS_X,
+      Shape::BOUNDING_RADIUS_Y, Shape::HAS_ANALYTIC_AREA,
+      Shape::ANALYTIC_AREA, honorsClassifierKernel,
+      &evaluateShape<Shape, double>, &evaluateShape<Shape, float>,
+      &ShapeClassifier<Shape>::classifyRange };
+}
+
+const ShapeKernels BATMAN_KERNELS = makeShapeKernels<BatmanShape>(true);
+const ShapeKernels ELLIPSE_KERNELS = makeShapeKernels<EllipseShape>(false);
+const ShapeKernels ANNULUS_KERNELS = makeShapeKernels<AnnulusShape>(false);
+const ShapeKernels HEART_KERNELS = makeShapeKernels<HeartShape>(false);
+}
+
+const ShapeKernels* ShapeFactory::getShapeKernels(const uint8_t shapeType) {
+  switch (shapeType) {
+  case ShapeType::BATMAN:
+    return &BATMAN_KERNELS;
+
+  case ShapeType::ELLIPSE:
+    return &ELLIPSE_KERNELS;
+
+  case ShapeType::ANNULUS:
+    return &ANNULUS_KERNELS;
+
+  case ShapeType::HEART:
+    return &HEART_KERNELS;
+
+  default:
+    return nullptr;
+  }
+}
@@ -0,0 +1,69 @@
+#ifndef MONTECARLO_SHAPES_SHAPEFACTORY_H_
+#define MONTECARLO_SHAPES_SHAPEFACTORY_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <cstddef>
+
+//Other libraries headers
+
+//Own components headers
+#include "common/CommonStructs.hpp"
+
+//Forward declarations
+
+/** @brief properties and entry points of a ShapeClassifier<Shape>
+ *         instantiation. The shape is selected once at start-up and is
+ *         then called through these pointers once per block of points,
+ *         while the per-point loops inside are specialized for the shape
+ * */
+struct ShapeKernels {
+  //classifies a range of points and accumulates the counters.
+  //The ClassifierKernel is used only by shapes with dedicated kernels
+  using EvaluateFunction = void (*)(const double *xs, const double *ys,
+      const size_t count, const MonteCarloArgs &args, const uint8_t kernel,
+      EvaluationCounters &outCounters);
+
+  //same as EvaluateFunction for points stored in single precision
+  using EvaluateFloatFunction = void (*)(const float *xs, const float *ys,
+      const size_t count, const MonteCarloArgs &args, const uint8_t kernel,
+      EvaluationCounters &outCounters);
+
+  //stores the PointRegion of every point in a range
+  using ClassifyFunction = void (*)(const double *xs, const double *ys,
+      const size_t count, const MonteCarloArgs &args, uint8_t *outRegions);
+
+  const char *name;
+
+  //radii of the bounding ellipse in shape units
+  double boundingRadiusX;
+  double boundingRadiusY;
+
+  bool hasAnalyticArea;
+  double analyticArea;
+
+  //whether evaluate honors the ClassifierKernel (SIMD and SEGMENTS)
+  bool honorsClassifierKernel;
+
+  EvaluateFunction evaluate;
+  EvaluateFloatFunction evaluateFloat;
+  ClassifyFunction classify;
+};
+
+class ShapeFactory {
+public:
+  ~ShapeFactory() = delete;
+
+  /** @brief used to obtain the kernels of a shape
+   *
+   *  @param const uint8_t - ShapeType
+   *
+   *  @returns const ShapeKernels * - the kernels or nullptr for unknown
+   *                                  shape types
+   * */
+  static const ShapeKernels* getShapeKernels(const uint8_t shapeType);
+};
+
+#endif /* MONTECARLO_SHAPES_SHAPEFACTORY_H_ */
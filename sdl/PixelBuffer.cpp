@@ -0,0 +1,96 @@
+//Corresponding header
+#include "PixelBuffer.h"
+
+//C system headers
+
+//C++ system headers
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+
+//Other libraries headers
+
+//Own components headers
+#include "sdl/Renderer.h"
+
+namespace {
+//RGBA8888 packs the channels from the most significant byte
+constexpr uint32_t BACKGROUND_COLOR = 0x000000FF; //opaque black
+constexpr uint32_t POINT_COLOR = 0xFFFF00FF;      //opaque yellow
+}
+
+int32_t PixelBuffer::init(Renderer *renderer, const uint8_t rsrcId,
+                          const SDL_Point startPoint,
+                          const int32_t bufferWidth,
+                          const int32_t bufferHeight) {
+  _renderer = renderer;
+  _width = bufferWidth;
+  _height = bufferHeight;
+  drawParams.rsrcId = rsrcId;
+  drawParams.frame = 0;
+  drawParams.pos = startPoint;
+
+  _pixels.assign(static_cast<size_t>(_width) * _height, BACKGROUND_COLOR);
+
+  if (EXIT_SUCCESS != _renderer->getTextureContainer()->createStreamingTexture(
+          _width, _height, rsrcId)) {
+    fprintf(stderr, "Error, _textureContainer->createStreamingTexture() "
+        "failed\n");
+
+    return EXIT_FAILURE;
+  }
+
+  //the content of a new streaming texture is undefined - upload everything
+  invalidate();
+
+  return uploadChanges();
+}
+
+void PixelBuffer::drawPoints(const SDL_Point *points, const int32_t count) {
+  for (int32_t i = 0; i < count; ++i) {
+    const int32_t x = points[i].x;
+    const int32_t y = points[i].y;
+    if ((0 > x) || (x >= _width) || (0 > y) || (y >= _height)) {
+      continue;
+    }
+
+    _pixels[static_cast<size_t>(y) * _width + x] = POINT_COLOR;
+
+    _dirtyMinX = std::min(_dirtyMinX, x);
+    _dirtyMinY = std::min(_dirtyMinY, y);
+    _dirtyMaxX = std::max(_dirtyMaxX, x);
+    _dirtyMaxY = std::max(_dirtyMaxY, y);
+  }
+}
+
+int32_t PixelBuffer::uploadChanges() {
+  //nothing changed since the last upload
+  if (_dirtyMaxX < _dirtyMinX) {
+    return EXIT_SUCCESS;
+  }
+
+  const SDL_Rect dirtyRect = { _dirtyMinX, _dirtyMinY,
+      _dirtyMaxX - _dirtyMinX + 1, _dirtyMaxY - _dirtyMinY + 1 };
+  const uint32_t *firstPixel =
+      &_pixels[static_cast<size_t>(_dirtyMinY) * _width + _dirtyMinX];
+
+  resetDirtyRect();
+
+  return _renderer->getTextureContainer()->updateTexture(drawParams.rsrcId,
+      dirtyRect, firstPixel,
+      static_cast<int32_t>(_width * sizeof(uint32_t)));
+}
+
+void PixelBuffer::invalidate() {
+  _dirtyMinX = 0;
+  _dirtyMinY = 0;
+  _dirtyMaxX = _width - 1;
+  _dirtyMaxY = _height - 1;
+}
+
+void PixelBuffer::resetDirtyRect() {
+  _dirtyMinX = _width;
+  _dirtyMinY = _height;
+  _dirtyMaxX = -1;
+  _dirtyMaxY = -1;
+}
@@ -0,0 +1,73 @@
+#ifndef SDL_PIXELBUFFER_H_
+#define SDL_PIXELBUFFER_H_
+
+//C system headers
+
+//C++ system headers
+#include <cstdint>
+#include <vector>
+
+//Other libraries headers
+
+//Own components headers
+#include "sdl/DrawParams.h"
+
+//Forward declarations
+class Renderer;
+
+/** @brief alternative to the FBO for layers, which only accumulate points.
+ *         The points are written into a CPU side RGBA8888 buffer and only
+ *         the rectangle, which changed since the previous upload, is
+ *         copied to a streaming texture. No render target switches are
+ *         needed, which is much cheaper on software renderers (llvmpipe)
+ * */
+class PixelBuffer {
+public:
+  int32_t init(Renderer *renderer, const uint8_t rsrcId,
+               const SDL_Point startPoint, const int32_t bufferWidth,
+               const int32_t bufferHeight);
+
+  DrawParams drawParams;
+
+  /** @brief sets the pixels of the points in the CPU side buffer.
+   *         Points outside of the buffer are ignored
+   *
+   *  @param const SDL_Point * - the points
+   *  @param const int32_t     - number of points
+   * */
+  void drawPoints(const SDL_Point *points, const int32_t count);
+
+  /** @brief copies the changed part of the buffer to the texture
+   *
+   *  @returns int32_t - error code
+   * */
+  int32_t uploadChanges();
+
+  /** @brief direct access to the width * height RGBA8888 pixels.
+   *         Call invalidate() after modifying them
+   * */
+  inline uint32_t* getPixels() {
+    return _pixels.data();
+  }
+
+  //marks the whole buffer as changed
+  void invalidate();
+
+private:
+  void resetDirtyRect();
+
+  Renderer *_renderer = nullptr;
+
+  std::vector<uint32_t> _pixels;
+
+  int32_t _width = 0;
+  int32_t _height = 0;
+
+  //bounding box of the pixels changed since the last upload
+  int32_t _dirtyMinX = 0;
+  int32_t _dirtyMinY = 0;
+  int32_t _dirtyMaxX = -1;
+  int32_t _dirtyMaxY = -1;
+};
+
+#endif /* SDL_PIXELBUFFER_H_ */
@@ -9,6 +9,7 @@
 //Other libraries headers
 #include <SDL_render.h>
 #include <SDL_hints.h>
+#include <SDL_video.h>
 
 //Own components headers
 #include "DrawParams.h"
@@ -151,3 +152,22 @@ void Renderer::drawPoints(const SDL_Point *points, const int32_t count) {
   SDL_SetRenderDrawColor(_sdlRenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
 }
 
+int32_t Renderer::getRefreshRate() const {
+  const int32_t displayIdx = SDL_GetWindowDisplayIndex(_window);
+  if (0 > displayIdx) {
+    fprintf(stderr, "Error in, SDL_GetWindowDisplayIndex(), "
+        "SDL Error: %s\n", SDL_GetError());
+
+    return 0;
+  }
+
+  SDL_DisplayMode displayMode;
+  if (EXIT_SUCCESS != SDL_GetCurrentDisplayMode(displayIdx, &displayMode)) {
+    fprintf(stderr, "Error in, SDL_GetCurrentDisplayMode(), "
+        "SDL Error: %s\n", SDL_GetError());
+
+    return 0;
+  }
+
+  return displayMode.refresh_rate;
+}
@@ -91,9 +91,16 @@ public:
 
   void drawPoints(const SDL_Point *points, const int32_t count);
 
+  /** @brief refresh rate of the display, which contains the window
+   *
+   *  @returns int32_t - refresh rate in Hz or 0 if it is unknown
+   * */
+  int32_t getRefreshRate() const;
+
 private:
   enum InternalDefines {
-    MAX_WIDGET_COUNT = 100
+    //every glyph of a Text is a separate widget
+    MAX_WIDGET_COUNT = 512
   };
 
   //The window we'll be rendering to
@@ -4,28 +4,46 @@
 //C system headers
 
 //C++ system headers
+#include <cstdlib>
+#include <cstring>
 
 //Other libraries headers
 
 //Own components headers
 #include "sdl/TextureContainer.h"
 
-int32_t Text::init(TextureContainer *textureContainer, const uint8_t rsrcId,
+int32_t Text::init(TextureContainer *textureContainer,
                    const SDL_Point startPoint, const char *startText,
                    const int32_t fontSize) {
   _textureContainer = textureContainer;
-  drawParams.rsrcId = rsrcId;
-  drawParams.frame = 0;
-  drawParams.pos = startPoint;
+  _pos = startPoint;
   _fontSize = fontSize;
 
-  _textureContainer->setText(startText, fontSize, rsrcId, &_width, &_height);
+  setText(startText);
 
   return EXIT_SUCCESS;
 }
 
 void Text::setText(const char *text) {
-  _textureContainer->setText(text, _fontSize, drawParams.rsrcId, &_width,
-      &_height);
+  if (0 == strncmp(_content, text, MAX_LENGTH)) {
+    return;
+  }
+  strncpy(_content, text, MAX_LENGTH);
+
+  glyphsCount = 0;
+  int32_t penX = _pos.x;
+
+  for (int32_t i = 0; ('\0' != text[i]) && (MAX_LENGTH > i); ++i) {
+    DrawParams &glyph = glyphs[glyphsCount];
+    const int32_t advance = _textureContainer->getGlyph(_fontSize, text[i],
+        glyph);
+
+    if (UINT8_MAX != glyph.rsrcId) {
+      glyph.pos.x = penX;
+      glyph.pos.y = _pos.y;
+      ++glyphsCount;
+    }
+
+    penX += advance;
+  }
 }
-
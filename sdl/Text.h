@@ -14,24 +14,40 @@
 //Forward declarations
 class TextureContainer;
 
+/** @brief single line text drawn from the glyph atlas of its font.
+ *         Every visible character is a separate DrawParams, so changing
+ *         the text neither allocates nor rasterizes anything
+ * */
 class Text {
 public:
-  int32_t init(TextureContainer *textureContainer, const uint8_t rsrcId,
+  enum Limits {
+    MAX_LENGTH = 64
+  };
+
+  int32_t init(TextureContainer *textureContainer,
                const SDL_Point startPoint, const char *startText,
                const int32_t fontSize);
 
+  /** @brief lays out the text. Does nothing if the text did not change.
+   *         Characters after MAX_LENGTH are dropped
+   *
+   *  @param const char * - null terminated text
+   * */
   void setText(const char *text);
 
-  DrawParams drawParams;
+  //draw specific data of the visible glyphs
+  DrawParams glyphs[MAX_LENGTH];
+  int32_t glyphsCount = 0;
 
 private:
   TextureContainer *_textureContainer = nullptr;
 
-  int32_t _fontSize = 0;
+  SDL_Point _pos = { 0, 0 };
+
+  //the currently laid out text
+  char _content[MAX_LENGTH + 1] = { };
 
-  int32_t _width = 0;
-  int32_t _height = 0;
+  int32_t _fontSize = 0;
 };
 
 #endif /* SDL_TEXT_H_ */
-
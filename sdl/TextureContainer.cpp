@@ -5,6 +5,7 @@
 
 //C++ system headers
 #include <cstdlib>
+#include <algorithm>
 
 //Other libraries headers
 #include <SDL_render.h>
@@ -25,6 +26,10 @@ TextureContainer::TextureContainer() {
   _color.g = 0;
   _color.b = 0;
   _color.a = 255;
+
+  std::fill(std::begin(_smallGlyphAdvances), std::end(_smallGlyphAdvances),
+      0);
+  std::fill(std::begin(_bigGlyphAdvances), std::end(_bigGlyphAdvances), 0);
 }
 
 int32_t TextureContainer::init(SDL_Renderer *renderer) {
@@ -86,6 +91,12 @@ void TextureContainer::setText(const char *text, const int32_t fontSize,
   _textureFrameRects[textureId][0].w = loadedSurface->w;
   _textureFrameRects[textureId][0].h = loadedSurface->h;
 
+  //the previous texture of the text is no longer needed
+  if (nullptr != _textures[textureId]) {
+    SDL_DestroyTexture(_textures[textureId]);
+    _textures[textureId] = nullptr;
+  }
+
   //create hardware accelerated texture
   if (EXIT_SUCCESS != loadTextureFromSurface(loadedSurface,
           _textures[textureId])) {
@@ -95,6 +106,27 @@ void TextureContainer::setText(const char *text, const int32_t fontSize,
   }
 }
 
+int32_t TextureContainer::getGlyph(const int32_t fontSize,
+                                   const char character,
+                                   DrawParams &outParams) const {
+  const int32_t glyphIdx = static_cast<unsigned char>(character) - FIRST_GLYPH;
+  if ((0 > glyphIdx) || (GLYPHS_COUNT <= glyphIdx)) {
+    outParams.rsrcId = UINT8_MAX;
+    return 0;
+  }
+
+  const bool isSmall = (FontSize::SMALL == fontSize);
+  const uint8_t atlasId = isSmall ? Textures::SMALL_GLYPHS :
+                                    Textures::BIG_GLYPHS;
+
+  outParams.rsrcId =
+      (0 < _textureFrameRects[atlasId][glyphIdx].w) ? atlasId : UINT8_MAX;
+  outParams.frame = static_cast<uint8_t>(glyphIdx);
+
+  return isSmall ? _smallGlyphAdvances[glyphIdx] :
+                   _bigGlyphAdvances[glyphIdx];
+}
+
 int32_t TextureContainer::createEmptyTexture(const int32_t textureWidth,
                                              const int32_t textureHeight,
                                              const uint8_t textureId) {
@@ -122,6 +154,39 @@ int32_t TextureContainer::createEmptyTexture(const int32_t textureWidth,
   return err;
 }
 
+int32_t TextureContainer::createStreamingTexture(const int32_t textureWidth,
+                                                 const int32_t textureHeight,
+                                                 const uint8_t textureId) {
+  _textures[textureId] = SDL_CreateTexture(_renderer,
+      SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, textureWidth,
+      textureHeight);
+
+  if (nullptr == _textures[textureId]) {
+    fprintf(stderr, "SDL_CreateTexture() failed: %s\n", SDL_GetError());
+
+    return EXIT_FAILURE;
+  }
+
+  _textureFrameRects[textureId][0].w = textureWidth;
+  _textureFrameRects[textureId][0].h = textureHeight;
+
+  return EXIT_SUCCESS;
+}
+
+int32_t TextureContainer::updateTexture(const uint8_t textureId,
+                                        const SDL_Rect &rect,
+                                        const void *pixels,
+                                        const int32_t pitch) {
+  if (EXIT_SUCCESS != SDL_UpdateTexture(_textures[textureId], &rect, pixels,
+          pitch)) {
+    fprintf(stderr, "SDL_UpdateTexture() failed: %s\n", SDL_GetError());
+
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
 int32_t TextureContainer::loadTextures() {
   int32_t err = EXIT_SUCCESS;
 
@@ -145,7 +210,107 @@ int32_t TextureContainer::loadTextures() {
     err = EXIT_FAILURE;
   }
 
-  return err;
+  if (EXIT_SUCCESS != err) {
+    return err;
+  }
+
+  if (EXIT_SUCCESS != createGlyphAtlas(_fontSmall, Textures::SMALL_GLYPHS,
+          _smallGlyphAdvances)) {
+    fprintf(stderr, "Error in createGlyphAtlas() for the small font\n");
+
+    return EXIT_FAILURE;
+  }
+
+  if (EXIT_SUCCESS != createGlyphAtlas(_fontBig, Textures::BIG_GLYPHS,
+          _bigGlyphAdvances)) {
+    fprintf(stderr, "Error in createGlyphAtlas() for the big font\n");
+
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int32_t TextureContainer::createGlyphAtlas(TTF_Font *font,
+                                           const uint8_t textureId,
+                                           int32_t *outAdvances) {
+  SDL_Surface *glyphSurfaces[GLYPHS_COUNT];
+  std::vector<SDL_Rect> &glyphRects = _textureFrameRects[textureId];
+  glyphRects.assign(GLYPHS_COUNT, SDL_Rect { 0, 0, 0, 0 });
+
+  //rasterize every glyph and place it on the current row of the atlas
+  int32_t penX = 0;
+  int32_t penY = 0;
+  int32_t rowHeight = 0;
+  int32_t atlasWidth = 0;
+  for (int32_t i = 0; i < GLYPHS_COUNT; ++i) {
+    const Uint16 character = static_cast<Uint16>(FIRST_GLYPH + i);
+
+    int32_t advance = 0;
+    if (0 != TTF_GlyphMetrics(font, character, nullptr, nullptr, nullptr,
+            nullptr, &advance)) {
+      advance = 0;
+    }
+    outAdvances[i] = advance;
+
+    //blank glyphs (e.g. the space) may fail to render - only advance
+    glyphSurfaces[i] = TTF_RenderGlyph_Blended(font, character, _color);
+    if (nullptr == glyphSurfaces[i]) {
+      continue;
+    }
+
+    if (MAX_ATLAS_WIDTH < penX + glyphSurfaces[i]->w) {
+      penX = 0;
+      penY += rowHeight;
+      rowHeight = 0;
+    }
+
+    glyphRects[i] = SDL_Rect { penX, penY, glyphSurfaces[i]->w,
+        glyphSurfaces[i]->h };
+    penX += glyphSurfaces[i]->w;
+    rowHeight = std::max(rowHeight, glyphSurfaces[i]->h);
+    atlasWidth = std::max(atlasWidth, penX);
+  }
+
+  int32_t err = EXIT_SUCCESS;
+  SDL_Surface *atlas = SDL_CreateRGBSurfaceWithFormat(0,
+      std::max(atlasWidth, 1), std::max(penY + rowHeight, 1), 32,
+      SDL_PIXELFORMAT_RGBA32);
+  if (nullptr == atlas) {
+    fprintf(stderr, "SDL_CreateRGBSurfaceWithFormat() failed: %s\n",
+        SDL_GetError());
+
+    err = EXIT_FAILURE;
+  }
+
+  for (int32_t i = 0; i < GLYPHS_COUNT; ++i) {
+    if (nullptr == glyphSurfaces[i]) {
+      continue;
+    }
+
+    if (nullptr != atlas) {
+      //copy the alpha channel as is instead of blending it
+      SDL_SetSurfaceBlendMode(glyphSurfaces[i], SDL_BLENDMODE_NONE);
+      SDL_Rect dstRect = glyphRects[i];
+      SDL_BlitSurface(glyphSurfaces[i], nullptr, atlas, &dstRect);
+    }
+    SDL_FreeSurface(glyphSurfaces[i]);
+  }
+
+  if (EXIT_SUCCESS != err) {
+    return err;
+  }
+
+  //frees the atlas surface on success
+  if (EXIT_SUCCESS != loadTextureFromSurface(atlas, _textures[textureId])) {
+    fprintf(stderr, "Unable to create the glyph atlas with Id: %hhu\n",
+        textureId);
+    SDL_FreeSurface(atlas);
+
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
 }
 
 int32_t TextureContainer::loadSingleTexture(const char *filePath,
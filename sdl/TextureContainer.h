@@ -12,6 +12,7 @@
 #include <SDL2/SDL_rect.h>
 
 //Own components headers
+#include "sdl/DrawParams.h"
 
 //Forward declarations
 struct SDL_Texture;
@@ -31,10 +32,50 @@ public:
                const uint8_t textureId, int32_t *outTextWidth,
                int32_t *outTextHeight);
 
+  /** @brief looks up a character in the glyph atlas of a font.
+   *         Does not allocate and does not call SDL_ttf, so strings can be
+   *         laid out every frame
+   *
+   *  @param const int32_t - FontSize of the atlas
+   *  @param const char    - the character
+   *  @param DrawParams &  - rsrcId and frame of the glyph. rsrcId is
+   *                         UINT8_MAX if there is nothing to draw (blank or
+   *                         unsupported character)
+   *
+   *  @returns int32_t     - horizontal advance of the glyph in pixels
+   * */
+  int32_t getGlyph(const int32_t fontSize, const char character,
+                   DrawParams &outParams) const;
+
   int32_t createEmptyTexture(const int32_t textureWidth,
                              const int32_t textureHeight,
                              const uint8_t textureId);
 
+  /** @brief creates a texture, whose pixels are written by the CPU
+   *         with updateTexture()
+   *
+   *  @param const int32_t - texture width
+   *  @param const int32_t - texture height
+   *  @param const uint8_t - unique resource ID of the texture
+   *
+   *  @returns int32_t     - error code
+   * */
+  int32_t createStreamingTexture(const int32_t textureWidth,
+                                 const int32_t textureHeight,
+                                 const uint8_t textureId);
+
+  /** @brief uploads RGBA8888 pixels to a part of a streaming texture
+   *
+   *  @param const uint8_t    - unique resource ID of the texture
+   *  @param const SDL_Rect & - the updated part of the texture
+   *  @param const void *     - the pixels of the top left corner of rect
+   *  @param const int32_t    - bytes between two rows of the pixels
+   *
+   *  @returns int32_t        - error code
+   * */
+  int32_t updateTexture(const uint8_t textureId, const SDL_Rect &rect,
+                        const void *pixels, const int32_t pitch);
+
   inline SDL_Texture* getTexture(const uint8_t textureId) const {
     return _textures[textureId];
   }
@@ -63,6 +104,32 @@ private:
 
   void populateTextureFrameRects();
 
+  /** @brief rasterizes the printable ASCII characters of a font once
+   *         and packs them into a single texture. Every glyph is a
+   *         separate frame rectangle of that texture
+   *
+   *  @param TTF_Font *    - the font
+   *  @param const uint8_t - unique resource ID of the atlas texture
+   *  @param int32_t *     - [out] advances of the glyphs
+   *
+   *  @returns int32_t     - error code
+   * */
+  int32_t createGlyphAtlas(TTF_Font *font, const uint8_t textureId,
+                           int32_t *outAdvances);
+
+  enum InternalDefines {
+    FIRST_GLYPH = 32, //space
+    LAST_GLYPH = 126, //tilde
+    GLYPHS_COUNT = LAST_GLYPH - FIRST_GLYPH + 1,
+
+    //the glyphs are packed in rows not wider than this
+    MAX_ATLAS_WIDTH = 2048
+  };
+
+  //horizontal advances of the glyphs of the small and the big fonts
+  int32_t _smallGlyphAdvances[GLYPHS_COUNT];
+  int32_t _bigGlyphAdvances[GLYPHS_COUNT];
+
   //the textures we'll be drawing
   std::vector<SDL_Texture*> _textures;
 